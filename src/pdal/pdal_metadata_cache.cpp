@@ -0,0 +1,227 @@
+#include "pdal_metadata_cache.hpp"
+
+// PDAL
+#include <pdal/PluginManager.hpp>
+#include <pdal/PointTable.hpp>
+#include <pdal/Stage.hpp>
+#include <pdal/StageFactory.hpp>
+#include <pdal/io/LasHeader.hpp>
+#include <pdal/io/LasReader.hpp>
+
+namespace duckdb {
+
+// ######################################################################################################################
+// File Metadata
+// ######################################################################################################################
+
+namespace {
+
+// Copy the fields of the header of a LAS/LAZ file.
+void ReadLasHeader(const pdal::LasHeader &header, PdalFileMetadata &result) {
+	result.has_las_header = true;
+	result.compressed = header.compressed();
+	result.file_signature = header.fileSignature();
+	result.file_source_id = header.fileSourceId();
+	result.global_encoding = header.globalEncoding();
+	result.project_id = header.projectId().toString();
+	result.version_major = header.versionMajor();
+	result.version_minor = header.versionMinor();
+	result.system_id = header.systemId();
+	result.software_id = header.softwareId();
+	result.creation_doy = header.creationDOY();
+	result.creation_year = header.creationYear();
+
+	result.point_format = header.pointFormat();
+	result.point_offset = header.pointOffset();
+	result.point_len = header.pointLen();
+
+	result.scale[0] = header.scaleX();
+	result.scale[1] = header.scaleY();
+	result.scale[2] = header.scaleZ();
+	result.offset[0] = header.offsetX();
+	result.offset[1] = header.offsetY();
+	result.offset[2] = header.offsetZ();
+
+	result.header_point_count = header.pointCount();
+	for (uint32_t i = 0; i < header.maxReturnCount(); i++) {
+		result.points_by_return.push_back(header.pointCountByReturn(i));
+	}
+}
+
+} // namespace
+
+std::shared_ptr<const PdalFileMetadata> PdalFileMetadata::Read(const std::string &file_name,
+                                                               const pdal::Options &options) {
+
+	auto result = std::make_shared<PdalFileMetadata>();
+
+	result->driver = pdal::StageFactory::inferReaderDriver(file_name);
+	if (result->driver.length() == 0) {
+		throw InvalidInputException("File format not supported: %s", file_name);
+	}
+
+	pdal::Options read_options = options;
+	read_options.add("filename", file_name);
+
+	// The layout and the summary of the file come from the reader of its driver. LAS/LAZ files are opened once, the
+	// fields of their header come from the same reader.
+	std::unique_ptr<pdal::Stage> reader;
+	pdal::LasReader *las_reader = nullptr;
+
+	if (result->driver == "readers.las") {
+		auto las = std::make_unique<pdal::LasReader>();
+		las_reader = las.get();
+		reader = std::move(las);
+	} else {
+		reader = pdal::PluginManager<pdal::Stage>::createObject(result->driver);
+	}
+	if (!reader) {
+		throw InvalidInputException("Driver not found for file: %s", file_name);
+	}
+	reader->setOptions(read_options);
+
+	pdal::PointTable table;
+	reader->prepare(table);
+
+	pdal::PointLayoutPtr layout = table.layout();
+	for (const auto &dim_id : layout->dims()) {
+		result->dimensions.emplace_back(layout->dimName(dim_id), layout->dimType(dim_id));
+	}
+	result->streamable = reader->pipelineStreamable();
+
+	const pdal::QuickInfo info = reader->preview();
+	result->valid = info.valid();
+	result->point_count = info.m_pointCount;
+	result->bounds = info.m_bounds;
+	result->srs_wkt = info.m_srs.getWKT();
+
+	if (las_reader) {
+		ReadLasHeader(las_reader->header(), *result);
+		return std::move(result);
+	}
+
+	// Other LAS/LAZ files (e.g. COPC) are read again as plain LAS files to get the fields of their header.
+	const auto lower_path = StringUtil::Lower(file_name);
+
+	if (StringUtil::EndsWith(lower_path, ".las") || StringUtil::EndsWith(lower_path, ".laz")) {
+		pdal::LasReader header_reader;
+		pdal::Options las_options;
+		las_options.add("filename", file_name);
+		header_reader.setOptions(las_options);
+
+		pdal::FixedPointTable las_table(5);
+		header_reader.prepare(las_table);
+		ReadLasHeader(header_reader.header(), *result);
+	}
+	return std::move(result);
+}
+
+// ######################################################################################################################
+// Metadata Cache
+// ######################################################################################################################
+
+namespace {
+
+// Get the size and the modification time of a file, returns false if the file system can't open it (e.g. a URI only
+// known by PDAL), then its metadata is not cached.
+bool StatFile(ClientContext &context, const std::string &file_name, int64_t &file_size, timestamp_t &last_modified) {
+	auto &fs = FileSystem::GetFileSystem(context);
+
+	try {
+		auto handle = fs.OpenFile(file_name, FileFlags::FILE_FLAGS_READ);
+		file_size = fs.GetFileSize(*handle);
+		last_modified = fs.GetLastModifiedTime(*handle);
+		return true;
+	} catch (std::exception &) {
+		return false;
+	}
+}
+
+// The options of the reader change the layout and the summary of a file, they are part of the key of the cache.
+std::string CacheKey(const std::string &file_name, const pdal::Options &options) {
+	std::string key = file_name;
+
+	for (const auto &option : options.getOptions()) {
+		key += '\n' + option.getName() + '=' + option.getValue();
+	}
+	return key;
+}
+
+} // namespace
+
+shared_ptr<PdalMetadataCache> PdalMetadataCache::Get(ClientContext &context) {
+	auto &cache = ObjectCache::GetObjectCache(context);
+	return cache.GetOrCreate<PdalMetadataCache>(ObjectType());
+}
+
+std::shared_ptr<const PdalFileMetadata> PdalMetadataCache::GetMetadata(ClientContext &context,
+                                                                      const std::string &file_name,
+                                                                      const pdal::Options &options) {
+
+	idx_t capacity = DEFAULT_CAPACITY;
+	Value setting;
+	if (context.TryGetCurrentSetting(CAPACITY_SETTING, setting) && !setting.IsNull()) {
+		capacity = setting.GetValue<uint64_t>();
+	}
+
+	int64_t file_size = 0;
+	timestamp_t last_modified;
+
+	if (capacity == 0 || !StatFile(context, file_name, file_size, last_modified)) {
+		return PdalFileMetadata::Read(file_name, options);
+	}
+	const auto key = CacheKey(file_name, options);
+
+	{
+		std::lock_guard<std::mutex> guard(lock);
+
+		auto entry = index.find(key);
+		if (entry != index.end()) {
+			if (entry->second->file_size == file_size && entry->second->last_modified == last_modified) {
+				entries.splice(entries.begin(), entries, entry->second);
+				return entry->second->metadata;
+			}
+			entries.erase(entry->second);
+			index.erase(entry);
+		}
+	}
+
+	// Read the file without holding the lock, other threads may read the same file meanwhile.
+	auto metadata = PdalFileMetadata::Read(file_name, options);
+
+	std::lock_guard<std::mutex> guard(lock);
+
+	auto entry = index.find(key);
+	if (entry != index.end()) {
+		entries.erase(entry->second);
+		index.erase(entry);
+	}
+	entries.push_front({key, file_name, file_size, last_modified, metadata});
+	index.emplace(key, entries.begin());
+
+	Evict(capacity);
+	return metadata;
+}
+
+void PdalMetadataCache::Evict(idx_t capacity) {
+	while (entries.size() > capacity) {
+		index.erase(entries.back().key);
+		entries.pop_back();
+	}
+}
+
+std::vector<PdalMetadataCache::Entry> PdalMetadataCache::Entries() {
+	std::lock_guard<std::mutex> guard(lock);
+	return std::vector<Entry>(entries.begin(), entries.end());
+}
+
+idx_t PdalMetadataCache::Clear() {
+	std::lock_guard<std::mutex> guard(lock);
+
+	const idx_t count = entries.size();
+	entries.clear();
+	index.clear();
+	return count;
+}
+
+} // namespace duckdb
@@ -0,0 +1,111 @@
+#pragma once
+
+// DuckDB
+#include "duckdb.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+// PDAL
+#include <pdal/Dimension.hpp>
+#include <pdal/Options.hpp>
+#include <pdal/util/Bounds.hpp>
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace duckdb {
+
+//! The metadata of a point cloud file, read from its header without loading the points.
+struct PdalFileMetadata {
+	//! Reader driver of the file, and whether it supports stream mode.
+	std::string driver;
+	bool streamable = false;
+
+	//! Summary of the file from the preview of the reader.
+	bool valid = false;
+	uint64_t point_count = 0;
+	pdal::BOX3D bounds;
+	std::string srs_wkt;
+
+	//! Name and type of the dimensions of the point layout.
+	std::vector<std::pair<std::string, pdal::Dimension::Type>> dimensions;
+
+	//! Fields of the LAS/LAZ header, only set for files with the .las or .laz extension.
+	bool has_las_header = false;
+	bool compressed = false;
+	std::string file_signature;
+	uint16_t file_source_id = 0;
+	uint16_t global_encoding = 0;
+	std::string project_id = "00000000-0000-0000-0000-000000000000";
+	uint8_t version_major = 0;
+	uint8_t version_minor = 0;
+	std::string system_id;
+	std::string software_id;
+	uint16_t creation_doy = 0;
+	uint16_t creation_year = 0;
+	uint8_t point_format = 0;
+	uint32_t point_offset = 0;
+	uint16_t point_len = 0;
+	double scale[3] = {0.01, 0.01, 0.01};
+	double offset[3] = {0.0, 0.0, 0.0};
+	uint64_t header_point_count = 0;
+	std::vector<uint64_t> points_by_return;
+
+	//! Read the metadata of a file, preparing its reader with the given options.
+	static std::shared_ptr<const PdalFileMetadata> Read(const std::string &file_name, const pdal::Options &options);
+};
+
+//! An LRU cache of the metadata of point cloud files, one per database in its object cache. The entries are keyed by
+//! the path of the file and the options of its reader, and only used while the size and the modification time of the
+//! file are unchanged.
+class PdalMetadataCache final : public ObjectCacheEntry {
+public:
+	//! Name of the setting with the maximum number of entries of the cache, zero disables it.
+	static constexpr const char *CAPACITY_SETTING = "pdal_metadata_cache_size";
+	static constexpr idx_t DEFAULT_CAPACITY = 4096;
+
+	//! A cached entry, as listed by the PDAL_MetadataCache table function.
+	struct Entry {
+		std::string key;
+		std::string file_name;
+		int64_t file_size;
+		timestamp_t last_modified;
+		std::shared_ptr<const PdalFileMetadata> metadata;
+	};
+
+	PdalMetadataCache() = default;
+
+	//! Get the metadata cache of the database of a client context, created on its first use.
+	static shared_ptr<PdalMetadataCache> Get(ClientContext &context);
+
+	static std::string ObjectType() {
+		return "pdal_metadata_cache";
+	}
+
+	std::string GetObjectType() override {
+		return ObjectType();
+	}
+
+	//! Get the metadata of a file, reading it if it is not cached or if the file changed since it was cached.
+	std::shared_ptr<const PdalFileMetadata> GetMetadata(ClientContext &context, const std::string &file_name,
+	                                                    const pdal::Options &options = pdal::Options());
+
+	//! Get a copy of the entries of the cache, from the most to the least recently used.
+	std::vector<Entry> Entries();
+	//! Remove all the entries of the cache, returns the number of entries removed.
+	idx_t Clear();
+
+private:
+	//! Remove the least recently used entries above the capacity.
+	void Evict(idx_t capacity);
+
+	std::mutex lock;
+	std::list<Entry> entries;
+	std::unordered_map<std::string, std::list<Entry>::iterator> index;
+};
+
+} // namespace duckdb
@@ -0,0 +1,132 @@
+#include "pdal_pipeline_template.hpp"
+
+// PDAL
+#include <pdal/Stage.hpp>
+#include <pdal/util/FileUtils.hpp>
+
+#include <sstream>
+#include <unordered_map>
+
+namespace duckdb {
+
+// ######################################################################################################################
+// Pipeline Template
+// ######################################################################################################################
+
+PdalPipelineTemplate::PdalPipelineTemplate(const std::string &json) {
+
+	pdal::PipelineManager pipeline;
+	std::stringstream ssin(json);
+	pipeline.readPipeline(ssin);
+
+	std::vector<pdal::Stage *> roots = pipeline.roots();
+	if (roots.size() > 1) {
+		throw InvalidInputException("Can't process pipeline with more than one root.");
+	}
+	if (roots.size() == 0) {
+		throw InvalidInputException("Pipeline has no root stage.");
+	}
+
+	// The stages are added to the pipeline in the order of the definition, the inputs of a stage precede it.
+	std::unordered_map<const pdal::Stage *, std::size_t> stage_indexes;
+
+	for (pdal::Stage *stage : pipeline.stages()) {
+		StageSpec spec;
+		spec.type = stage->getName();
+		spec.options = stage->getOptions();
+
+		for (const pdal::Stage *input : stage->getInputs()) {
+			auto entry = stage_indexes.find(input);
+			if (entry == stage_indexes.end()) {
+				throw InvalidInputException("Input of stage '%s' not defined before it in the pipeline", spec.type);
+			}
+			spec.inputs.push_back(entry->second);
+		}
+		stage_indexes.emplace(stage, stages.size());
+		stages.push_back(std::move(spec));
+	}
+}
+
+std::shared_ptr<const PdalPipelineTemplate> PdalPipelineTemplate::Get(ClientContext &context,
+                                                                     const std::string &definition) {
+
+	std::string json;
+
+	if (StringUtil::StartsWith(definition, "[") && StringUtil::EndsWith(definition, "]")) {
+		json = definition;
+	} else {
+		if (!pdal::FileUtils::fileExists(definition)) {
+			throw InvalidInputException("Pipeline file not found: %s", definition);
+		}
+		// Only the parsing is cached, pipeline files are read on every bind to pick up their changes.
+		json = pdal::FileUtils::readFileIntoString(definition);
+	}
+
+	auto cache = PdalPipelineTemplateCache::Get(context);
+
+	auto result = cache->Find(json);
+	if (result) {
+		return result;
+	}
+
+	// Parse the definition without holding the lock of the cache, other threads may parse the same one meanwhile.
+	result = std::shared_ptr<const PdalPipelineTemplate>(new PdalPipelineTemplate(json));
+	cache->Add(json, result);
+	return result;
+}
+
+std::unique_ptr<pdal::PipelineManager> PdalPipelineTemplate::Instantiate() const {
+
+	auto pipeline = std::make_unique<pdal::PipelineManager>();
+	std::vector<pdal::Stage *> created;
+
+	for (const auto &spec : stages) {
+		pdal::Stage &stage = pipeline->makeFilter(spec.type, spec.options);
+
+		for (const auto input : spec.inputs) {
+			stage.setInput(*created[input]);
+		}
+		created.push_back(&stage);
+	}
+	return pipeline;
+}
+
+// ######################################################################################################################
+// Template Cache
+// ######################################################################################################################
+
+shared_ptr<PdalPipelineTemplateCache> PdalPipelineTemplateCache::Get(ClientContext &context) {
+	auto &cache = ObjectCache::GetObjectCache(context);
+	return cache.GetOrCreate<PdalPipelineTemplateCache>(ObjectType());
+}
+
+std::shared_ptr<const PdalPipelineTemplate> PdalPipelineTemplateCache::Find(const std::string &json) {
+	std::lock_guard<std::mutex> guard(lock);
+
+	auto entry = index.find(json);
+	if (entry == index.end()) {
+		return nullptr;
+	}
+	entries.splice(entries.begin(), entries, entry->second);
+	return entry->second->second;
+}
+
+void PdalPipelineTemplateCache::Add(const std::string &json,
+                                    std::shared_ptr<const PdalPipelineTemplate> pipeline_template) {
+	std::lock_guard<std::mutex> guard(lock);
+
+	auto entry = index.find(json);
+	if (entry != index.end()) {
+		entries.erase(entry->second);
+		index.erase(entry);
+	}
+	entries.emplace_front(json, std::move(pipeline_template));
+	index.emplace(json, entries.begin());
+
+	while (entries.size() > CAPACITY) {
+		index.erase(entries.back().first);
+		entries.pop_back();
+	}
+}
+
+} // namespace duckdb
@@ -0,0 +1,80 @@
+#pragma once
+
+// DuckDB
+#include "duckdb.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+// PDAL
+#include <pdal/Options.hpp>
+#include <pdal/PipelineManager.hpp>
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace duckdb {
+
+//! A parsed and validated PDAL pipeline definition. New pipelines are created from it for each input file without
+//! reading and parsing the JSON definition again.
+class PdalPipelineTemplate final {
+public:
+	//! Get the template of a pipeline definition, an inline JSON array or the path of a JSON file. The template is
+	//! parsed on the first use of the definition and taken from the template cache of the database afterwards.
+	static std::shared_ptr<const PdalPipelineTemplate> Get(ClientContext &context, const std::string &definition);
+
+	//! Create a new pipeline with the stages of the template, without any reader bound to its root.
+	std::unique_ptr<pdal::PipelineManager> Instantiate() const;
+
+private:
+	//! A stage of the pipeline, with the indexes of its input stages.
+	struct StageSpec {
+		std::string type;
+		pdal::Options options;
+		std::vector<std::size_t> inputs;
+	};
+
+	//! Parse and validate a JSON pipeline definition.
+	explicit PdalPipelineTemplate(const std::string &json);
+
+	//! The stages of the pipeline, each one after its inputs.
+	std::vector<StageSpec> stages;
+};
+
+//! An LRU cache of the parsed pipeline definitions, one per database in its object cache. The entries are keyed by
+//! the JSON content of the definitions, so editing a pipeline file takes effect in the next query.
+class PdalPipelineTemplateCache final : public ObjectCacheEntry {
+public:
+	//! Maximum number of parsed definitions kept by the cache.
+	static constexpr idx_t CAPACITY = 256;
+
+	PdalPipelineTemplateCache() = default;
+
+	//! Get the template cache of the database of a client context, created on its first use.
+	static shared_ptr<PdalPipelineTemplateCache> Get(ClientContext &context);
+
+	static std::string ObjectType() {
+		return "pdal_pipeline_template_cache";
+	}
+
+	std::string GetObjectType() override {
+		return ObjectType();
+	}
+
+	//! Get the cached template of a JSON definition, or nullptr if it is not cached.
+	std::shared_ptr<const PdalPipelineTemplate> Find(const std::string &json);
+	//! Add the template of a JSON definition, evicting the least recently used templates above the capacity.
+	void Add(const std::string &json, std::shared_ptr<const PdalPipelineTemplate> pipeline_template);
+
+private:
+	using Entry = std::pair<std::string, std::shared_ptr<const PdalPipelineTemplate>>;
+
+	std::mutex lock;
+	std::list<Entry> entries;
+	std::unordered_map<std::string, std::list<Entry>::iterator> index;
+};
+
+} // namespace duckdb
@@ -0,0 +1,234 @@
+#include "pdal_point_sink.hpp"
+
+// DuckDB
+#include "duckdb/common/exception.hpp"
+
+// PDAL
+#include <pdal/Reader.hpp>
+#include <pdal/Streamable.hpp>
+#include <pdal/pdal_types.hpp>
+
+#include <cstring>
+#include <utility>
+
+namespace duckdb {
+
+namespace {
+
+// Thrown into the writer thread to unwind the PDAL stream loop when the producers go away. It is a PDAL error, so
+// the writer unwinds through the cleanup paths of its own errors.
+struct SinkCancelled : public pdal::pdal_error {
+	SinkCancelled() : pdal::pdal_error("The point sink was cancelled") {
+	}
+};
+
+} // namespace
+
+// ######################################################################################################################
+// PDAL Point Batch
+// ######################################################################################################################
+
+PdalPointBatch::PdalPointBatch(std::size_t point_size_p) : point_size(point_size_p) {
+}
+
+char *PdalPointBatch::Append(std::size_t append_count) {
+	const std::size_t offset = count * point_size;
+
+	data.resize(offset + append_count * point_size);
+	std::memset(data.data() + offset, 0, append_count * point_size);
+	count += append_count;
+	return data.data() + offset;
+}
+
+bool PdalPointBatch::Next(char *point) {
+	if (position >= count) {
+		return false;
+	}
+	std::memcpy(point, data.data() + position * point_size, point_size);
+	position++;
+	return true;
+}
+
+void PdalPointBatch::Clear() {
+	count = 0;
+	position = 0;
+}
+
+// ######################################################################################################################
+// Queue Table
+// ######################################################################################################################
+
+// The stream table of the writer, whose points are copied whole from the packed data of the batches.
+class PdalPointSink::QueueTable final : public pdal::FixedPointTable {
+public:
+	explicit QueueTable(pdal::point_count_t capacity) : pdal::FixedPointTable(capacity) {
+	}
+
+	char *PointData(pdal::PointId idx) {
+		return getPoint(idx);
+	}
+};
+
+// ######################################################################################################################
+// Queue Reader
+// ######################################################################################################################
+
+class PdalPointSink::QueueReader final : public pdal::Reader, public pdal::Streamable {
+public:
+	explicit QueueReader(PdalPointSink &sink_p) : sink(sink_p), current(nullptr) {
+	}
+
+	std::string getName() const override {
+		return "readers.duckdb";
+	}
+
+protected:
+	// Copy the next point sent to the sink into the stream, the batches are released once all their points are read.
+	bool processOne(pdal::PointRef &point) override {
+		char *point_data = sink.table->PointData(point.pointId());
+
+		while (!current || !current->Next(point_data)) {
+			if (current) {
+				sink.Release();
+			}
+			current = sink.Pop();
+
+			if (!current) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+private:
+	PdalPointSink &sink;
+	PdalPointBatch *current;
+};
+
+// ######################################################################################################################
+// PDAL Point Sink
+// ######################################################################################################################
+
+PdalPointSink::PdalPointSink(pdal::point_count_t capacity_p, std::size_t queue_size_p)
+    : capacity(capacity_p), queue_size(queue_size_p) {
+
+	reader = std::unique_ptr<QueueReader>(new QueueReader(*this));
+	table = std::unique_ptr<QueueTable>(new QueueTable(capacity));
+}
+
+PdalPointSink::~PdalPointSink() {
+	Cancel();
+}
+
+pdal::Stage &PdalPointSink::Reader() {
+	return *reader;
+}
+
+pdal::StreamPointTable &PdalPointSink::Table() {
+	return *table;
+}
+
+void PdalPointSink::Start(pdal::Stage &writer) {
+	table->finalize();
+
+	consumer = std::thread([this, &writer]() {
+		try {
+			writer.execute(static_cast<pdal::StreamPointTable &>(*table));
+		} catch (SinkCancelled &) {
+			// The producers do not send more points
+		} catch (...) {
+			std::lock_guard<std::mutex> guard(lock);
+			if (!cancelled) {
+				error = std::current_exception();
+			}
+		}
+		std::lock_guard<std::mutex> guard(lock);
+		finished = true;
+		queue.clear();
+		current.reset();
+		cv.notify_all();
+	});
+}
+
+std::unique_ptr<PdalPointBatch> PdalPointSink::NewBatch() {
+	{
+		std::lock_guard<std::mutex> guard(lock);
+
+		if (!pool.empty()) {
+			auto batch = std::move(pool.back());
+			pool.pop_back();
+			return batch;
+		}
+	}
+	return std::unique_ptr<PdalPointBatch>(new PdalPointBatch(table->layout()->pointSize()));
+}
+
+void PdalPointSink::Push(std::unique_ptr<PdalPointBatch> batch) {
+	std::unique_lock<std::mutex> guard(lock);
+
+	cv.wait(guard, [&]() { return queue.size() < queue_size || finished; });
+
+	if (error) {
+		std::rethrow_exception(error);
+	}
+	if (finished) {
+		throw IOException("The PDAL writer stopped before all points were written");
+	}
+	queue.push_back(std::move(batch));
+	cv.notify_all();
+}
+
+void PdalPointSink::Finish() {
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		closed = true;
+		cv.notify_all();
+	}
+	if (consumer.joinable()) {
+		consumer.join();
+	}
+	if (error) {
+		std::rethrow_exception(error);
+	}
+}
+
+PdalPointBatch *PdalPointSink::Pop() {
+	std::unique_lock<std::mutex> guard(lock);
+
+	cv.wait(guard, [&]() { return !queue.empty() || closed || cancelled; });
+
+	if (cancelled) {
+		throw SinkCancelled();
+	}
+	if (queue.empty()) {
+		return nullptr;
+	}
+	current = std::move(queue.front());
+	queue.pop_front();
+	cv.notify_all();
+	return current.get();
+}
+
+void PdalPointSink::Release() {
+	std::lock_guard<std::mutex> guard(lock);
+
+	// Keep the memory of the batch for the next ones, at most one per queued batch
+	if (pool.size() < queue_size) {
+		current->Clear();
+		pool.push_back(std::move(current));
+	}
+	current.reset();
+}
+
+void PdalPointSink::Cancel() {
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		cancelled = true;
+		cv.notify_all();
+	}
+	if (consumer.joinable()) {
+		consumer.join();
+	}
+}
+
+} // namespace duckdb
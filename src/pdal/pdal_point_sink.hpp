@@ -0,0 +1,111 @@
+#pragma once
+
+// PDAL
+#include <pdal/PointTable.hpp>
+#include <pdal/Stage.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace duckdb {
+
+//! A batch of packed points sent to a PdalPointSink, with the layout of the table of the sink. The batches are
+//! filled by the producers and copied point by point into the stream by the writer thread.
+class PdalPointBatch {
+public:
+	explicit PdalPointBatch(std::size_t point_size);
+
+	//! Add zeroed points to the batch, returns the packed data of the first one. The points are contiguous.
+	char *Append(std::size_t count);
+	//! Get the number of points of the batch.
+	std::size_t Size() const {
+		return count;
+	}
+	//! Get the size of the packed data of a point.
+	std::size_t PointSize() const {
+		return point_size;
+	}
+	//! Copy the next point of the batch into the packed data of a point. Returns false when the batch is exhausted.
+	bool Next(char *point);
+	//! Remove all the points, keeping the memory to reuse the batch.
+	void Clear();
+
+private:
+	std::size_t point_size;
+	std::vector<char> data;
+	std::size_t count = 0;
+	std::size_t position = 0;
+};
+
+//! Runs a streamable PDAL writer on a background thread, feeding it with the batches of points sent by the
+//! producers through a bounded queue. Memory usage is bounded by the size of the queue instead of by the size of
+//! the output.
+class PdalPointSink {
+public:
+	//! Default number of points of the stream table.
+	static constexpr pdal::point_count_t DEFAULT_CAPACITY = 65536;
+	//! Default number of batches waiting to be written, e.g. one per chunk of DuckDB.
+	static constexpr std::size_t DEFAULT_QUEUE_SIZE = 32;
+
+	explicit PdalPointSink(pdal::point_count_t capacity = DEFAULT_CAPACITY,
+	                       std::size_t queue_size = DEFAULT_QUEUE_SIZE);
+	~PdalPointSink();
+
+	PdalPointSink(const PdalPointSink &) = delete;
+	PdalPointSink &operator=(const PdalPointSink &) = delete;
+
+	//! Get the reader of the points sent to the sink, to be set as the input of the writer.
+	pdal::Stage &Reader();
+	//! Get the table to prepare the writer with, the dimensions of the points are registered into its layout.
+	pdal::StreamPointTable &Table();
+
+	//! Start streaming the points into the writer, which must be prepared with the table of the sink.
+	void Start(pdal::Stage &writer);
+	//! Get an empty batch for the layout of the table, reusing the memory of the batches already written.
+	std::unique_ptr<PdalPointBatch> NewBatch();
+	//! Queue a batch of points to write, blocks while the queue is full. Rethrows the errors of the writer, and
+	//! throws if the writer stopped without reading all the points.
+	void Push(std::unique_ptr<PdalPointBatch> batch);
+	//! Wait until all the points are written and the writer is done. Rethrows the errors of the writer.
+	void Finish();
+	//! Stop the writer thread, discarding pending points.
+	void Cancel();
+
+private:
+	class QueueReader;
+	class QueueTable;
+	friend class QueueReader;
+
+	//! Called from the writer thread to get the next batch, blocks while the queue is empty. Returns nullptr when
+	//! all the batches have been sent.
+	PdalPointBatch *Pop();
+	//! Called from the writer thread when all the points of the last popped batch have been read.
+	void Release();
+
+	pdal::point_count_t capacity;
+	std::size_t queue_size;
+
+	std::unique_ptr<QueueReader> reader;
+	std::unique_ptr<QueueTable> table;
+	std::thread consumer;
+
+	std::mutex lock;
+	std::condition_variable cv;
+	std::deque<std::unique_ptr<PdalPointBatch>> queue;
+	// The batch being read by the writer, kept alive until it is released.
+	std::unique_ptr<PdalPointBatch> current;
+	// The batches already written, reused by the producers.
+	std::vector<std::unique_ptr<PdalPointBatch>> pool;
+	bool closed = false;
+	bool finished = false;
+	bool cancelled = false;
+	std::exception_ptr error;
+};
+
+} // namespace duckdb
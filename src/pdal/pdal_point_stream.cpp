@@ -0,0 +1,145 @@
+#include "pdal_point_stream.hpp"
+
+// PDAL
+#include <pdal/pdal_types.hpp>
+
+namespace duckdb {
+
+namespace {
+
+// Thrown into the producer thread to unwind the PDAL stream loop when the consumer goes away. It is a PDAL error,
+// so the stages unwind through the cleanup paths of their own errors. A stage that swallows it gets it again at the
+// next batch, and an error rethrown in its place is discarded.
+struct StreamCancelled : public pdal::pdal_error {
+	StreamCancelled() : pdal::pdal_error("The point stream was cancelled") {
+	}
+};
+
+} // namespace
+
+// ######################################################################################################################
+// Handoff Table
+// ######################################################################################################################
+
+class PdalPointStream::HandoffTable final : public pdal::FixedPointTable {
+public:
+	HandoffTable(PdalPointStream &stream_p, pdal::point_count_t capacity)
+	    : pdal::FixedPointTable(capacity), stream(stream_p) {
+	}
+
+	const char *PointData(pdal::PointId idx) {
+		return getPoint(idx);
+	}
+
+protected:
+	// Called by PDAL once all stages have processed the current batch and before its contents are overwritten.
+	void reset() override {
+		stream.Handoff(numPoints());
+		pdal::FixedPointTable::reset();
+	}
+
+private:
+	PdalPointStream &stream;
+};
+
+// ######################################################################################################################
+// PDAL Point Stream
+// ######################################################################################################################
+
+PdalPointStream::PdalPointStream(pdal::Stage &stage, pdal::point_count_t capacity) {
+
+	table = std::unique_ptr<HandoffTable>(new HandoffTable(*this, capacity));
+
+	// Prepare the stage here, so errors in the options or in the header of the input are reported to the caller.
+	stage.prepare(*table);
+	table->finalize();
+
+	producer = std::thread([this, &stage]() {
+		try {
+			stage.execute(static_cast<pdal::StreamPointTable &>(*table));
+		} catch (StreamCancelled &) {
+			// The consumer does not want more points
+		} catch (...) {
+			std::lock_guard<std::mutex> guard(lock);
+			if (!cancelled) {
+				error = std::current_exception();
+			}
+		}
+		std::lock_guard<std::mutex> guard(lock);
+		finished = true;
+		cv.notify_all();
+	});
+}
+
+PdalPointStream::~PdalPointStream() {
+	Cancel();
+}
+
+bool PdalPointStream::Next() {
+	std::unique_lock<std::mutex> guard(lock);
+
+	// Release the current batch, the producer can overwrite it now
+	if (batch_ready) {
+		batch_ready = false;
+		batch_size = 0;
+		cv.notify_all();
+	}
+	cv.wait(guard, [&]() { return batch_ready || finished; });
+
+	if (batch_ready) {
+		return true;
+	}
+	if (error) {
+		std::rethrow_exception(error);
+	}
+	return false;
+}
+
+pdal::PointLayoutPtr PdalPointStream::Layout() const {
+	return table->layout();
+}
+
+pdal::PointContainer &PdalPointStream::Container() {
+	return *table;
+}
+
+bool PdalPointStream::Skipped(pdal::PointId idx) const {
+	return table->skip(idx);
+}
+
+const char *PdalPointStream::GetPoint(pdal::PointId idx) const {
+	return table->PointData(idx);
+}
+
+void PdalPointStream::Handoff(pdal::point_count_t count) {
+	std::unique_lock<std::mutex> guard(lock);
+
+	if (cancelled) {
+		throw StreamCancelled();
+	}
+	if (count == 0) {
+		return;
+	}
+	batch_size = count;
+	batch_ready = true;
+	cv.notify_all();
+
+	cv.wait(guard, [&]() { return !batch_ready || cancelled; });
+
+	if (cancelled) {
+		throw StreamCancelled();
+	}
+}
+
+void PdalPointStream::Cancel() {
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		cancelled = true;
+		cv.notify_all();
+	}
+	if (producer.joinable()) {
+		producer.join();
+	}
+}
+
+} // namespace duckdb
@@ -0,0 +1,73 @@
+#pragma once
+
+// PDAL
+#include <pdal/PointTable.hpp>
+#include <pdal/Stage.hpp>
+
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace duckdb {
+
+//! Runs a PDAL stage in stream mode on a background thread, handing the points over to the consumer in batches
+//! of fixed capacity. Memory usage is bounded by the capacity of the batch instead of by the size of the input.
+//!
+//! PDAL drives the stream loop itself, so the stage runs on its own thread, but the two threads take turns: the
+//! consumer waits in Next() while the stage fills a batch, and the stage waits while the consumer scans it. A scan
+//! with N DuckDB threads has up to 2N OS threads, of which at most N do work, so `SET threads` still bounds the CPU
+//! used by PDAL.
+class PdalPointStream {
+public:
+	//! Default number of points of each batch.
+	static constexpr pdal::point_count_t DEFAULT_CAPACITY = 65536;
+
+	//! Prepare the stage and start streaming it. The stage must be streamable and outlive this object.
+	explicit PdalPointStream(pdal::Stage &stage, pdal::point_count_t capacity = DEFAULT_CAPACITY);
+	//! Cancel the stream and join the producer thread. A producer waiting for the consumer to release a full batch
+	//! is woken up and unwinds, so a scan stopped early (e.g. by a LIMIT or an error) does not leave it blocked.
+	~PdalPointStream();
+
+	PdalPointStream(const PdalPointStream &) = delete;
+	PdalPointStream &operator=(const PdalPointStream &) = delete;
+
+	//! Release the current batch and wait for the next one. Returns false when the stage is exhausted.
+	bool Next();
+
+	//! Get the layout of the streamed points.
+	pdal::PointLayoutPtr Layout() const;
+	//! Get the point container of the current batch.
+	pdal::PointContainer &Container();
+	//! Get the number of points of the current batch.
+	pdal::point_count_t BatchSize() const {
+		return batch_size;
+	}
+	//! Returns true if the point of the current batch was discarded by a filter of the pipeline.
+	bool Skipped(pdal::PointId idx) const;
+	//! Get the packed data of a point of the current batch.
+	const char *GetPoint(pdal::PointId idx) const;
+
+private:
+	class HandoffTable;
+	friend class HandoffTable;
+
+	//! Called from the producer thread when a batch is full, blocks until the consumer releases it.
+	void Handoff(pdal::point_count_t count);
+	//! Stop the producer thread, discarding pending points.
+	void Cancel();
+
+	std::unique_ptr<HandoffTable> table;
+	std::thread producer;
+
+	std::mutex lock;
+	std::condition_variable cv;
+	bool batch_ready = false;
+	bool finished = false;
+	bool cancelled = false;
+	std::exception_ptr error;
+	pdal::point_count_t batch_size = 0;
+};
+
+} // namespace duckdb
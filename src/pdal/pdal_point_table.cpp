@@ -0,0 +1,92 @@
+#include "pdal_point_table.hpp"
+
+#include <iterator>
+
+namespace duckdb {
+
+PdalReleasablePointTable::PdalReleasablePointTable() : pdal::SimplePointTable(layout_ref), num_points(0) {
+}
+
+PdalReleasablePointTable::~PdalReleasablePointTable() {
+}
+
+pdal::PointId PdalReleasablePointTable::addPoint() {
+	if (num_points % BLOCK_SIZE == 0) {
+		// Zeroed like the blocks of pdal::PointTable, the stages expect the fields not set yet to be zero.
+		blocks.emplace_back(new char[pointsToBytes(BLOCK_SIZE)]());
+		references.push_back(0);
+		block_addresses.emplace(blocks.back().get(), blocks.size() - 1);
+	}
+	return num_points++;
+}
+
+char *PdalReleasablePointTable::getPoint(pdal::PointId idx) {
+	char *block = blocks[idx / BLOCK_SIZE].get();
+	return block + pointsToBytes(idx % BLOCK_SIZE);
+}
+
+std::size_t PdalReleasablePointTable::FindBlock(const char *point) const {
+	// The last block starting at or before the address of the point
+	auto entry = block_addresses.upper_bound(point);
+	return std::prev(entry)->second;
+}
+
+void PdalReleasablePointTable::CountReferences(pdal::PointView &view, pdal::PointId begin, pdal::PointId end,
+                                               std::map<std::size_t, int64_t> &counts) const {
+
+	const std::size_t block_bytes = pointsToBytes(BLOCK_SIZE);
+	const char *block_begin = nullptr;
+	std::size_t block_idx = 0;
+
+	for (pdal::PointId idx = begin; idx < end; idx++) {
+		const char *point = view.getPoint(idx);
+
+		// The points of a view are mostly consecutive, only look up the block when leaving the last one.
+		if (!block_begin || point < block_begin || point >= block_begin + block_bytes) {
+			block_idx = FindBlock(point);
+			block_begin = blocks[block_idx].get();
+		}
+		counts[block_idx]++;
+	}
+}
+
+void PdalReleasablePointTable::Retain(pdal::PointView &view) {
+	std::lock_guard<std::mutex> guard(lock);
+
+	std::map<std::size_t, int64_t> counts;
+	CountReferences(view, 0, view.size(), counts);
+
+	for (const auto &entry : counts) {
+		references[entry.first] += entry.second;
+	}
+}
+
+void PdalReleasablePointTable::Release(pdal::PointView &view, pdal::PointId begin, pdal::PointId end) {
+	// The lookup of the blocks must not race with other threads freeing blocks
+	std::lock_guard<std::mutex> guard(lock);
+
+	std::map<std::size_t, int64_t> counts;
+	CountReferences(view, begin, end, counts);
+
+	for (const auto &entry : counts) {
+		references[entry.first] -= entry.second;
+
+		if (references[entry.first] <= 0 && blocks[entry.first]) {
+			block_addresses.erase(blocks[entry.first].get());
+			blocks[entry.first].reset();
+		}
+	}
+}
+
+void PdalReleasablePointTable::ReleaseUnreferenced() {
+	std::lock_guard<std::mutex> guard(lock);
+
+	for (std::size_t block_idx = 0; block_idx < blocks.size(); block_idx++) {
+		if (references[block_idx] <= 0 && blocks[block_idx]) {
+			block_addresses.erase(blocks[block_idx].get());
+			blocks[block_idx].reset();
+		}
+	}
+}
+
+} // namespace duckdb
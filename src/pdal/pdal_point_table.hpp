@@ -0,0 +1,61 @@
+#pragma once
+
+// PDAL
+#include <pdal/PointTable.hpp>
+#include <pdal/PointView.hpp>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace duckdb {
+
+//! A PDAL point table that stores the points in blocks which can be released once the points of the views
+//! referencing them have been consumed, instead of keeping the whole table alive until it is destroyed.
+class PdalReleasablePointTable final : public pdal::SimplePointTable {
+public:
+	//! Number of points of each block.
+	static constexpr pdal::point_count_t BLOCK_SIZE = 65536;
+
+	PdalReleasablePointTable();
+	~PdalReleasablePointTable() override;
+
+	PdalReleasablePointTable(const PdalReleasablePointTable &) = delete;
+	PdalReleasablePointTable &operator=(const PdalReleasablePointTable &) = delete;
+
+	bool supportsView() const override {
+		return true;
+	}
+
+	//! Add the references of the points of a view to their blocks, before the view is scanned.
+	void Retain(pdal::PointView &view);
+	//! Remove the references of a range of points of a view, the blocks without references are freed.
+	void Release(pdal::PointView &view, pdal::PointId begin, pdal::PointId end);
+	//! Free the blocks not referenced by any view, e.g. the points discarded by the filters of a pipeline.
+	void ReleaseUnreferenced();
+
+protected:
+	pdal::PointId addPoint() override;
+	char *getPoint(pdal::PointId idx) override;
+
+private:
+	//! Find the block of the packed data of a point.
+	std::size_t FindBlock(const char *point) const;
+	//! Count the references of a range of points of a view per block.
+	void CountReferences(pdal::PointView &view, pdal::PointId begin, pdal::PointId end,
+	                     std::map<std::size_t, int64_t> &counts) const;
+
+	pdal::PointLayout layout_ref;
+
+	std::vector<std::unique_ptr<char[]>> blocks;
+	std::vector<int64_t> references;
+	// Start address of each allocated block, to find the block of a point of a view.
+	std::map<const char *, std::size_t> block_addresses;
+	pdal::point_count_t num_points;
+
+	std::mutex lock;
+};
+
+} // namespace duckdb
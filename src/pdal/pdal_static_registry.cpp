@@ -35,6 +35,7 @@
 #include <pdal/filters/OutlierFilter.hpp>
 #include <pdal/filters/OverlayFilter.hpp>
 #include <pdal/filters/PMFFilter.hpp>
+#include <pdal/filters/RadialDensityFilter.hpp>
 #include <pdal/filters/RandomizeFilter.hpp>
 #include <pdal/filters/RangeFilter.hpp>
 #include <pdal/filters/ReciprocityFilter.hpp>
@@ -189,6 +190,9 @@ void PdalStaticRegistry::Register(ExtensionLoader &loader) {
 			volatile auto *pmf_filter = new pdal::PMFFilter();
 			delete pmf_filter;
 
+			volatile auto *radial_density_filter = new pdal::RadialDensityFilter();
+			delete radial_density_filter;
+
 			volatile auto *randomize_filter = new pdal::RandomizeFilter();
 			delete randomize_filter;
 
@@ -1,25 +1,48 @@
 #include "pdal_table_functions.hpp"
+#include "pdal_metadata_cache.hpp"
+#include "pdal_pipeline_template.hpp"
+#include "pdal_point_sink.hpp"
+#include "pdal_point_stream.hpp"
+#include "pdal_point_table.hpp"
 #include "function_builder.hpp"
 
 // DuckDB
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/extension/extension_loader.hpp"
 #include "duckdb/common/types.hpp"
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/common/types/uuid.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/common/multi_file/multi_file_reader.hpp"
 #include "duckdb/parser/expression/function_expression.hpp"
 #include "duckdb/parser/parsed_data/create_copy_function_info.hpp"
 #include "duckdb/parser/tableref/table_function_ref.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/planner/expression/bound_between_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 
 // PDAL
 #include <pdal/PipelineManager.hpp>
 #include <pdal/PluginManager.hpp>
 #include <pdal/Stage.hpp>
 #include <pdal/StageFactory.hpp>
+#include <pdal/Streamable.hpp>
 #include <pdal/io/BufferReader.hpp>
 #include <pdal/io/LasHeader.hpp>
 #include <pdal/io/LasReader.hpp>
 #include <pdal/util/FileUtils.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <sstream>
+
 namespace duckdb {
 
 namespace {
@@ -44,62 +67,98 @@ struct PDAL_Utils {
 		}
 	}
 
+	// Get the DuckDB type of the values of a PDAL dimension type.
+	static LogicalType DimensionType(pdal::Dimension::Type t) {
+
+		switch (t) {
+		case pdal::Dimension::Type::Float:
+			return LogicalTypeId::FLOAT;
+		case pdal::Dimension::Type::Double:
+			return LogicalTypeId::DOUBLE;
+
+		case pdal::Dimension::Type::Signed8:
+			return LogicalTypeId::TINYINT;
+		case pdal::Dimension::Type::Signed16:
+			return LogicalTypeId::SMALLINT;
+		case pdal::Dimension::Type::Signed32:
+			return LogicalTypeId::INTEGER;
+		case pdal::Dimension::Type::Signed64:
+			return LogicalTypeId::BIGINT;
+
+		case pdal::Dimension::Type::Unsigned8:
+			return LogicalTypeId::UTINYINT;
+		case pdal::Dimension::Type::Unsigned16:
+			return LogicalTypeId::USMALLINT;
+		case pdal::Dimension::Type::Unsigned32:
+			return LogicalTypeId::UINTEGER;
+		case pdal::Dimension::Type::Unsigned64:
+			return LogicalTypeId::UBIGINT;
+
+		default:
+			throw InvalidInputException("Field type %d not supported", t);
+		}
+	}
+
 	// Extract the PDAL PointLayout into DuckDB return types and names.
 	static void ExtractLayout(const pdal::PointLayoutPtr layout, vector<LogicalType> &return_types,
 	                          vector<string> &names) {
 
 		for (const auto &dimId : layout->dims()) {
-			std::string name = layout->dimName(dimId);
 			const pdal::Dimension::Detail *detail = layout->dimDetail(dimId);
-			pdal::Dimension::Type t = detail->type();
-
-			switch (t) {
-			case pdal::Dimension::Type::Float:
-				names.emplace_back(name);
-				return_types.emplace_back(LogicalTypeId::FLOAT);
-				break;
-			case pdal::Dimension::Type::Double:
-				names.emplace_back(name);
-				return_types.emplace_back(LogicalTypeId::DOUBLE);
-				break;
-
-			case pdal::Dimension::Type::Signed8:
-				names.emplace_back(name);
-				return_types.emplace_back(LogicalTypeId::TINYINT);
-				break;
-			case pdal::Dimension::Type::Signed16:
-				names.emplace_back(name);
-				return_types.emplace_back(LogicalTypeId::SMALLINT);
-				break;
-			case pdal::Dimension::Type::Signed32:
-				names.emplace_back(name);
-				return_types.emplace_back(LogicalTypeId::INTEGER);
-				break;
-			case pdal::Dimension::Type::Signed64:
-				names.emplace_back(name);
-				return_types.emplace_back(LogicalTypeId::BIGINT);
-				break;
-
-			case pdal::Dimension::Type::Unsigned8:
-				names.emplace_back(name);
-				return_types.emplace_back(LogicalTypeId::UTINYINT);
-				break;
-			case pdal::Dimension::Type::Unsigned16:
-				names.emplace_back(name);
-				return_types.emplace_back(LogicalTypeId::USMALLINT);
-				break;
-			case pdal::Dimension::Type::Unsigned32:
-				names.emplace_back(name);
-				return_types.emplace_back(LogicalTypeId::UINTEGER);
-				break;
-			case pdal::Dimension::Type::Unsigned64:
-				names.emplace_back(name);
-				return_types.emplace_back(LogicalTypeId::UBIGINT);
-				break;
+			return_types.push_back(DimensionType(detail->type()));
+			names.emplace_back(layout->dimName(dimId));
+		}
+	}
 
-			default:
-				throw InvalidInputException("Field type %d not supported", t);
-			}
+	// Map a DuckDB SQL type to a PDAL type, returns false if the type is not supported.
+	static bool FieldType(const LogicalType &sql_type, pdal::Dimension::Type &type) {
+		switch (sql_type.id()) {
+		case LogicalTypeId::FLOAT:
+			type = pdal::Dimension::Type::Float;
+			return true;
+		case LogicalTypeId::DOUBLE:
+		case LogicalTypeId::DECIMAL:
+			type = pdal::Dimension::Type::Double;
+			return true;
+
+		// Written as GPS time, the seconds since the GPS epoch
+		case LogicalTypeId::TIMESTAMP:
+		case LogicalTypeId::TIMESTAMP_TZ:
+			type = pdal::Dimension::Type::Double;
+			return true;
+
+		case LogicalTypeId::BOOLEAN:
+			type = pdal::Dimension::Type::Unsigned8;
+			return true;
+
+		case LogicalTypeId::TINYINT:
+			type = pdal::Dimension::Type::Signed8;
+			return true;
+		case LogicalTypeId::SMALLINT:
+			type = pdal::Dimension::Type::Signed16;
+			return true;
+		case LogicalTypeId::INTEGER:
+			type = pdal::Dimension::Type::Signed32;
+			return true;
+		case LogicalTypeId::BIGINT:
+			type = pdal::Dimension::Type::Signed64;
+			return true;
+
+		case LogicalTypeId::UTINYINT:
+			type = pdal::Dimension::Type::Unsigned8;
+			return true;
+		case LogicalTypeId::USMALLINT:
+			type = pdal::Dimension::Type::Unsigned16;
+			return true;
+		case LogicalTypeId::UINTEGER:
+			type = pdal::Dimension::Type::Unsigned32;
+			return true;
+		case LogicalTypeId::UBIGINT:
+			type = pdal::Dimension::Type::Unsigned64;
+			return true;
+
+		default:
+			return false;
 		}
 	}
 
@@ -117,123 +176,570 @@ struct PDAL_Utils {
 			const auto &sql_type = sql_types[i];
 			const auto &name = names[i];
 
-			switch (sql_type.id()) {
-			case LogicalTypeId::FLOAT:
-				layout->registerOrAssignDim(name, pdal::Dimension::Type::Float);
-				break;
-			case LogicalTypeId::DOUBLE:
-				layout->registerOrAssignDim(name, pdal::Dimension::Type::Double);
-				break;
-
-			case LogicalTypeId::TINYINT:
-				layout->registerOrAssignDim(name, pdal::Dimension::Type::Signed8);
-				break;
-			case LogicalTypeId::SMALLINT:
-				layout->registerOrAssignDim(name, pdal::Dimension::Type::Signed16);
-				break;
-			case LogicalTypeId::INTEGER:
-				layout->registerOrAssignDim(name, pdal::Dimension::Type::Signed32);
-				break;
-			case LogicalTypeId::BIGINT:
-				layout->registerOrAssignDim(name, pdal::Dimension::Type::Signed64);
-				break;
-
-			case LogicalTypeId::UTINYINT:
-				layout->registerOrAssignDim(name, pdal::Dimension::Type::Unsigned8);
-				break;
-			case LogicalTypeId::USMALLINT:
-				layout->registerOrAssignDim(name, pdal::Dimension::Type::Unsigned16);
-				break;
-			case LogicalTypeId::UINTEGER:
-				layout->registerOrAssignDim(name, pdal::Dimension::Type::Unsigned32);
-				break;
-			case LogicalTypeId::UBIGINT:
-				layout->registerOrAssignDim(name, pdal::Dimension::Type::Unsigned64);
-				break;
-
-			default:
+			pdal::Dimension::Type type;
+			if (!FieldType(sql_type, type)) {
 				logger.WriteLog("pdal", LogLevel::LOG_WARN, "Field type '%s' not supported, skipping dimension '%s'.",
 				                sql_type.ToString().c_str(), name.c_str());
 				continue;
 			}
+			layout->registerOrAssignDim(name, type);
 			field_indexes.push_back(i);
 		}
 		return field_indexes;
 	}
 
-	// Write a chunk of points from a PDAL PointView into a DuckDB DataChunk.
-	static void WriteOutputChunk(pdal::PointViewPtr view, idx_t record_start, std::size_t output_size,
-	                             DataChunk &output) {
+	// An axis-aligned box in the X/Y/Z space, the unbounded sides are infinite.
+	struct BoundingBox {
+		double lower[3];
+		double upper[3];
 
-		pdal::PointLayoutPtr layout = view->layout();
-		pdal::PointRef point(*view, record_start);
+		BoundingBox() {
+			for (idx_t axis = 0; axis < 3; axis++) {
+				lower[axis] = -std::numeric_limits<double>::infinity();
+				upper[axis] = std::numeric_limits<double>::infinity();
+			}
+		}
 
-		for (idx_t row_idx = 0, point_idx = record_start; row_idx < output_size; row_idx++, point_idx++) {
+		bool IsBounded(idx_t axis) const {
+			return std::isfinite(lower[axis]) || std::isfinite(upper[axis]);
+		}
 
-			point.setPointId(point_idx);
-			idx_t col_idx = 0;
+		bool IsBounded() const {
+			return IsBounded(0) || IsBounded(1) || IsBounded(2);
+		}
 
-			for (const auto &dimId : layout->dims()) {
-				const pdal::Dimension::Detail *detail = layout->dimDetail(dimId);
-				pdal::Dimension::Type t = detail->type();
+		bool IsEmpty() const {
+			return lower[0] > upper[0] || lower[1] > upper[1] || lower[2] > upper[2];
+		}
 
-				switch (t) {
-				case pdal::Dimension::Type::Float: {
-					float value = point.getFieldAs<float>(dimId);
-					output.SetValue(col_idx, row_idx, duckdb::Value::FLOAT(value));
-					break;
-				}
-				case pdal::Dimension::Type::Double: {
-					double value = point.getFieldAs<double>(dimId);
-					output.SetValue(col_idx, row_idx, duckdb::Value::DOUBLE(value));
-					break;
+		bool Intersects(const BoundingBox &other) const {
+			for (idx_t axis = 0; axis < 3; axis++) {
+				if (other.upper[axis] < lower[axis] || other.lower[axis] > upper[axis]) {
+					return false;
 				}
-				case pdal::Dimension::Type::Signed8: {
-					int8_t value = point.getFieldAs<int8_t>(dimId);
-					output.SetValue(col_idx, row_idx, duckdb::Value::TINYINT(value));
-					break;
+			}
+			return true;
+		}
+
+		void Restrict(idx_t axis, double min_value, double max_value) {
+			lower[axis] = std::max(lower[axis], min_value);
+			upper[axis] = std::min(upper[axis], max_value);
+		}
+
+		void Clip(const BoundingBox &other) {
+			for (idx_t axis = 0; axis < 3; axis++) {
+				Restrict(axis, other.lower[axis], other.upper[axis]);
+			}
+		}
+
+		// NaN coordinates are never rejected, DuckDB sorts them above any other value.
+		bool Contains(const double *xyz) const {
+			for (idx_t axis = 0; axis < 3; axis++) {
+				if (xyz[axis] < lower[axis] || xyz[axis] > upper[axis]) {
+					return false;
 				}
-				case pdal::Dimension::Type::Signed16: {
-					int16_t value = point.getFieldAs<int16_t>(dimId);
-					output.SetValue(col_idx, row_idx, duckdb::Value::SMALLINT(value));
-					break;
+			}
+			return true;
+		}
+
+		// Format the box as a PDAL bounds option, "([minx, maxx], [miny, maxy], [minz, maxz])".
+		std::string ToBoundsOption() const {
+			std::ostringstream ss;
+			ss.precision(17);
+
+			const idx_t axis_count = IsBounded(2) ? 3 : 2;
+			ss << "(";
+			for (idx_t axis = 0; axis < axis_count; axis++) {
+				ss << (axis > 0 ? ", [" : "[");
+				ss << std::max(lower[axis], std::numeric_limits<double>::lowest()) << ", ";
+				ss << std::min(upper[axis], std::numeric_limits<double>::max()) << "]";
+			}
+			ss << ")";
+			return ss.str();
+		}
+	};
+
+	// Get the axis of a coordinate column, or -1 if the column is not a coordinate.
+	static int CoordinateAxis(const string &name) {
+		if (name == "X") {
+			return 0;
+		}
+		if (name == "Y") {
+			return 1;
+		}
+		if (name == "Z") {
+			return 2;
+		}
+		return -1;
+	}
+
+	// Get the axis of the coordinate column referenced by an expression of a filter, or -1.
+	static int CoordinateAxis(const Expression &expr, const LogicalGet &get, const vector<string> &names) {
+
+		if (expr.expression_class != ExpressionClass::BOUND_COLUMN_REF) {
+			return -1;
+		}
+		auto &colref = expr.Cast<BoundColumnRefExpression>();
+		if (colref.binding.table_index != get.table_index) {
+			return -1;
+		}
+		auto &column_ids = get.GetColumnIds();
+		if (colref.binding.column_index >= column_ids.size()) {
+			return -1;
+		}
+		auto column_idx = column_ids[colref.binding.column_index].GetPrimaryIndex();
+		if (column_idx >= names.size()) {
+			return -1;
+		}
+		return CoordinateAxis(names[column_idx]);
+	}
+
+	// Get the numeric value of a constant expression of a filter.
+	static bool TryGetConstant(const Expression &expr, double &result) {
+
+		if (expr.expression_class != ExpressionClass::BOUND_CONSTANT) {
+			return false;
+		}
+		auto &value = expr.Cast<BoundConstantExpression>().value;
+		if (value.IsNull() || !value.type().IsNumeric()) {
+			return false;
+		}
+		result = value.GetValue<double>();
+		return true;
+	}
+
+	// Narrow a box with the range comparisons on X/Y/Z of a filter expression. The box only needs to be a
+	// superset of the points matching the filter, DuckDB still applies the filter over the output.
+	static void ExtractBoundingBox(const Expression &expr, const LogicalGet &get, const vector<string> &names,
+	                               BoundingBox &box) {
+
+		switch (expr.expression_class) {
+		case ExpressionClass::BOUND_CONJUNCTION: {
+			if (expr.type == ExpressionType::CONJUNCTION_AND) {
+				for (const auto &child : expr.Cast<BoundConjunctionExpression>().children) {
+					ExtractBoundingBox(*child, get, names, box);
 				}
-				case pdal::Dimension::Type::Signed32: {
-					int32_t value = point.getFieldAs<int32_t>(dimId);
-					output.SetValue(col_idx, row_idx, duckdb::Value::INTEGER(value));
+			}
+			break;
+		}
+		case ExpressionClass::BOUND_BETWEEN: {
+			auto &between = expr.Cast<BoundBetweenExpression>();
+			auto axis = CoordinateAxis(*between.input, get, names);
+			double lower, upper;
+			if (axis >= 0 && TryGetConstant(*between.lower, lower) && TryGetConstant(*between.upper, upper)) {
+				box.Restrict(axis, lower, upper);
+			}
+			break;
+		}
+		case ExpressionClass::BOUND_COMPARISON: {
+			auto &comparison = expr.Cast<BoundComparisonExpression>();
+			auto comparison_type = expr.type;
+			double value;
+
+			auto axis = CoordinateAxis(*comparison.left, get, names);
+			if (axis >= 0 && TryGetConstant(*comparison.right, value)) {
+				// X <op> constant
+			} else {
+				axis = CoordinateAxis(*comparison.right, get, names);
+				if (axis < 0 || !TryGetConstant(*comparison.left, value)) {
 					break;
 				}
-				case pdal::Dimension::Type::Signed64: {
-					int64_t value = point.getFieldAs<int64_t>(dimId);
-					output.SetValue(col_idx, row_idx, duckdb::Value::BIGINT(value));
-					break;
+				// constant <op> X, flip the comparison
+				comparison_type = FlipComparisonExpression(comparison_type);
+			}
+
+			switch (comparison_type) {
+			case ExpressionType::COMPARE_EQUAL:
+				box.Restrict(axis, value, value);
+				break;
+			case ExpressionType::COMPARE_GREATERTHAN:
+			case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+				box.Restrict(axis, value, std::numeric_limits<double>::infinity());
+				break;
+			case ExpressionType::COMPARE_LESSTHAN:
+			case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+				box.Restrict(axis, -std::numeric_limits<double>::infinity(), value);
+				break;
+			default:
+				break;
+			}
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	// How the X/Y/Z coordinates of LAS/LAZ files are emitted: as doubles, as the scaled integers stored in the file,
+	// or as decimals with the digits of the scale of the file.
+	enum class CoordinateEncoding : uint8_t { DOUBLE, RAW, DECIMAL };
+
+	// Width of the decimals of the coordinates, the number of digits of the scale is set per file. The coordinates
+	// whose scaled integers may not fit in 18 digits are emitted with the wide width instead.
+	static constexpr uint8_t COORDINATE_DECIMAL_WIDTH = 18;
+	static constexpr uint8_t COORDINATE_WIDE_DECIMAL_WIDTH = 38;
+
+	// Get the number of decimal digits of a scale, the scale must be a power of ten.
+	static bool TryGetScaleDigits(double scale, uint8_t &digits) {
+		if (scale <= 0 || scale > 1) {
+			return false;
+		}
+		const double exponent = std::round(-std::log10(scale));
+		if (exponent >= COORDINATE_DECIMAL_WIDTH || std::abs(std::pow(10.0, -exponent) - scale) > scale * 1e-9) {
+			return false;
+		}
+		digits = static_cast<uint8_t>(exponent);
+		return true;
+	}
+
+	// A dimension of a PDAL PointLayout bound to a column of the output.
+	struct DimensionBinding {
+		idx_t column_idx;
+		pdal::Dimension::Type type;
+		std::size_t offset;
+		// Coordinates stored as integers of the scale of the file, instead of doubles.
+		CoordinateEncoding encoding = CoordinateEncoding::DOUBLE;
+		double scale = 1.0;
+		double scale_offset = 0.0;
+	};
+
+	// The projected output columns of a scan bound to the dimensions of a PDAL PointLayout.
+	struct ScanBindings {
+		std::vector<DimensionBinding> dimensions;
+		// Output columns not bound to any dimension (e.g. virtual columns), they are emitted as NULL.
+		std::vector<idx_t> null_columns;
+		// Output columns with the same value for all points of the scan (e.g. the file name).
+		std::vector<std::pair<idx_t, Value>> constant_columns;
+
+		// Output column with the points as WKB, built from the X/Y(/Z) dimensions.
+		bool has_geometry = false;
+		bool geometry_z = false;
+		idx_t geometry_column = 0;
+		std::size_t geometry_offsets[3];
+
+		// Points outside of this box are skipped before being copied into the output.
+		bool filter_points = false;
+		BoundingBox filter_box;
+		std::size_t filter_offsets[3];
+
+		// Points whose flag dimension is zero are skipped too, e.g. the halo of a tile.
+		bool filter_flag = false;
+		std::size_t flag_offset = 0;
+
+		// Emit a value for all points instead of NULL in an output column not bound to any dimension.
+		void SetConstant(idx_t col_idx, Value value) {
+			auto entry = std::find(null_columns.begin(), null_columns.end(), col_idx);
+			if (entry != null_columns.end()) {
+				null_columns.erase(entry);
+				constant_columns.emplace_back(col_idx, std::move(value));
+			}
+		}
+
+		// Returns true if the point passes the spatial filter of the scan.
+		bool Accepts(const char *point) const {
+			if (filter_flag) {
+				double flag;
+				std::memcpy(&flag, point + flag_offset, sizeof(double));
+				if (flag == 0) {
+					return false;
 				}
-				case pdal::Dimension::Type::Unsigned8: {
-					uint8_t value = point.getFieldAs<uint8_t>(dimId);
-					output.SetValue(col_idx, row_idx, duckdb::Value::UTINYINT(value));
-					break;
+			}
+			if (!filter_points) {
+				return true;
+			}
+			double xyz[3];
+			for (idx_t axis = 0; axis < 3; axis++) {
+				std::memcpy(&xyz[axis], point + filter_offsets[axis], sizeof(double));
+			}
+			return filter_box.Contains(xyz);
+		}
+	};
+
+	// Resolve the projected output columns against the dimensions of a PDAL PointLayout by name, once per scan.
+	// Dimensions missing in the layout are emitted as NULL if allowed, e.g. when the schema is the union of files.
+	static ScanBindings BindDimensions(pdal::PointLayoutPtr layout, const vector<string> &names,
+	                                   const vector<column_t> &column_ids, bool allow_missing = false) {
+
+		ScanBindings bindings;
+
+		for (idx_t col_idx = 0; col_idx < column_ids.size(); col_idx++) {
+			const auto column_id = column_ids[col_idx];
+
+			if (column_id >= names.size()) {
+				bindings.null_columns.push_back(col_idx);
+				continue;
+			}
+			pdal::Dimension::Id dim_id = layout->findDim(names[column_id]);
+
+			if (dim_id == pdal::Dimension::Id::Unknown) {
+				if (allow_missing) {
+					bindings.null_columns.push_back(col_idx);
+					continue;
 				}
-				case pdal::Dimension::Type::Unsigned16: {
-					uint16_t value = point.getFieldAs<uint16_t>(dimId);
-					output.SetValue(col_idx, row_idx, duckdb::Value::USMALLINT(value));
-					break;
+				throw InvalidInputException("Dimension '%s' not found in the point layout", names[column_id]);
+			}
+			const pdal::Dimension::Detail *detail = layout->dimDetail(dim_id);
+			bindings.dimensions.push_back({col_idx, detail->type(), static_cast<std::size_t>(detail->offset())});
+		}
+		return bindings;
+	}
+
+	// Get the type of the geometry column, WKB blobs that DuckDB spatial reads as GEOMETRY.
+	static LogicalType GeometryType() {
+		LogicalType type(LogicalTypeId::BLOB);
+		type.SetAlias("WKB_BLOB");
+		return type;
+	}
+
+	// Bind the output column of the geometry, it requires the X/Y dimensions stored as doubles, Z is optional. The
+	// geometry is built from the decoded doubles of the points, also when the X/Y/Z columns are raw or decimal.
+	static void BindGeometry(pdal::PointLayoutPtr layout, const vector<column_t> &column_ids, column_t geometry_id,
+	                         ScanBindings &bindings) {
+
+		const pdal::Dimension::Id dims[3] = {pdal::Dimension::Id::X, pdal::Dimension::Id::Y,
+		                                     pdal::Dimension::Id::Z};
+		bool has_dim[3];
+
+		for (idx_t axis = 0; axis < 3; axis++) {
+			has_dim[axis] = layout->hasDim(dims[axis]) && layout->dimType(dims[axis]) == pdal::Dimension::Type::Double;
+			if (has_dim[axis]) {
+				bindings.geometry_offsets[axis] = static_cast<std::size_t>(layout->dimDetail(dims[axis])->offset());
+			}
+		}
+		if (!has_dim[0] || !has_dim[1]) {
+			return;
+		}
+
+		for (idx_t col_idx = 0; col_idx < column_ids.size(); col_idx++) {
+			auto entry = std::find(bindings.null_columns.begin(), bindings.null_columns.end(), col_idx);
+
+			if (column_ids[col_idx] == geometry_id && entry != bindings.null_columns.end()) {
+				bindings.null_columns.erase(entry);
+				bindings.has_geometry = true;
+				bindings.geometry_z = has_dim[2];
+				bindings.geometry_column = col_idx;
+				return;
+			}
+		}
+	}
+
+	// Set the box used to skip points of the scan, it requires the X/Y/Z dimensions stored as doubles.
+	static void BindSpatialFilter(pdal::PointLayoutPtr layout, const BoundingBox &box, ScanBindings &bindings) {
+
+		if (!box.IsBounded()) {
+			return;
+		}
+		const pdal::Dimension::Id dims[3] = {pdal::Dimension::Id::X, pdal::Dimension::Id::Y,
+		                                     pdal::Dimension::Id::Z};
+
+		for (idx_t axis = 0; axis < 3; axis++) {
+			if (!layout->hasDim(dims[axis]) || layout->dimType(dims[axis]) != pdal::Dimension::Type::Double) {
+				return;
+			}
+			bindings.filter_offsets[axis] = static_cast<std::size_t>(layout->dimDetail(dims[axis])->offset());
+		}
+		bindings.filter_box = box;
+		bindings.filter_points = true;
+	}
+
+	// Set the output columns not bound to any dimension to NULL or to their constant value.
+	static void SetConstantColumns(const ScanBindings &bindings, DataChunk &output) {
+
+		for (const auto &col_idx : bindings.null_columns) {
+			output.data[col_idx].SetVectorType(VectorType::CONSTANT_VECTOR);
+			ConstantVector::SetNull(output.data[col_idx], true);
+		}
+		for (const auto &entry : bindings.constant_columns) {
+			output.data[entry.first].Reference(entry.second);
+		}
+	}
+
+	// Copy a field of a set of packed points into a flat vector of the same physical type.
+	template <class T>
+	static void CopyDimension(const char *const *points, idx_t count, std::size_t offset, Vector &target,
+	                          idx_t target_offset) {
+
+		T *data = FlatVector::GetData<T>(target) + target_offset;
+
+		for (idx_t i = 0; i < count; i++) {
+			std::memcpy(data + i, points[i] + offset, sizeof(T));
+		}
+	}
+
+	// Round a scaled coordinate to the integer of the column. The range of the decimals is checked at bind time, raw
+	// coordinates are the int32 integers stored in the file, but a reader may still move the points out of that range.
+	static void RoundScaled(double value, int32_t &result) {
+		const double rounded = std::round(value);
+
+		if (!(rounded >= static_cast<double>(NumericLimits<int32_t>::Minimum()) &&
+		      rounded <= static_cast<double>(NumericLimits<int32_t>::Maximum()))) {
+			throw OutOfRangeException("Raw coordinate %f does not fit in a 32-bit integer of the scale of the file",
+			                          value);
+		}
+		result = static_cast<int32_t>(rounded);
+	}
+	static void RoundScaled(double value, int64_t &result) {
+		result = static_cast<int64_t>(std::llround(value));
+	}
+	static void RoundScaled(double value, hugeint_t &result) {
+		result = Hugeint::Convert(std::round(value));
+	}
+
+	// Copy a double field of a set of packed points into a flat vector of integers of a scale.
+	template <class T>
+	static void CopyScaledDimension(const char *const *points, idx_t count, const DimensionBinding &binding,
+	                                Vector &target, idx_t target_offset) {
+
+		T *data = FlatVector::GetData<T>(target) + target_offset;
+
+		for (idx_t i = 0; i < count; i++) {
+			double value;
+			std::memcpy(&value, points[i] + binding.offset, sizeof(double));
+			RoundScaled((value - binding.scale_offset) / binding.scale, data[i]);
+		}
+	}
+
+	// Write the WKB points of a set of packed points into a blob vector, little endian POINT or POINT Z.
+	static void WriteGeometry(const char *const *points, idx_t count, const ScanBindings &bindings, Vector &target,
+	                          idx_t target_offset) {
+
+		string_t *data = FlatVector::GetData<string_t>(target) + target_offset;
+
+		const uint32_t wkb_type = bindings.geometry_z ? 1001 : 1;
+		const idx_t coordinate_count = bindings.geometry_z ? 3 : 2;
+		const idx_t wkb_size = sizeof(uint8_t) + sizeof(uint32_t) + coordinate_count * sizeof(double);
+
+		for (idx_t i = 0; i < count; i++) {
+			data[i] = StringVector::EmptyString(target, wkb_size);
+			char *wkb = data[i].GetDataWriteable();
+
+			wkb[0] = 1;
+			std::memcpy(wkb + 1, &wkb_type, sizeof(uint32_t));
+			wkb += sizeof(uint8_t) + sizeof(uint32_t);
+
+			for (idx_t axis = 0; axis < coordinate_count; axis++) {
+				std::memcpy(wkb + axis * sizeof(double), points[i] + bindings.geometry_offsets[axis], sizeof(double));
+			}
+			data[i].Finalize();
+		}
+	}
+
+	// Write a set of packed points into a DuckDB DataChunk, column by column, starting at the given offset of
+	// the output.
+	static void WriteOutputChunk(const ScanBindings &bindings, const char *const *points, idx_t count,
+	                             DataChunk &output, idx_t output_offset) {
+
+		for (const auto &binding : bindings.dimensions) {
+			Vector &target = output.data[binding.column_idx];
+
+			if (binding.encoding == CoordinateEncoding::RAW) {
+				CopyScaledDimension<int32_t>(points, count, binding, target, output_offset);
+				continue;
+			}
+			if (binding.encoding == CoordinateEncoding::DECIMAL) {
+				if (target.GetType().InternalType() == PhysicalType::INT128) {
+					CopyScaledDimension<hugeint_t>(points, count, binding, target, output_offset);
+				} else {
+					CopyScaledDimension<int64_t>(points, count, binding, target, output_offset);
 				}
-				case pdal::Dimension::Type::Unsigned32: {
-					uint32_t value = point.getFieldAs<uint32_t>(dimId);
-					output.SetValue(col_idx, row_idx, duckdb::Value::UINTEGER(value));
+				continue;
+			}
+
+			switch (binding.type) {
+			case pdal::Dimension::Type::Float:
+				CopyDimension<float>(points, count, binding.offset, target, output_offset);
+				break;
+			case pdal::Dimension::Type::Double:
+				CopyDimension<double>(points, count, binding.offset, target, output_offset);
+				break;
+			case pdal::Dimension::Type::Signed8:
+				CopyDimension<int8_t>(points, count, binding.offset, target, output_offset);
+				break;
+			case pdal::Dimension::Type::Signed16:
+				CopyDimension<int16_t>(points, count, binding.offset, target, output_offset);
+				break;
+			case pdal::Dimension::Type::Signed32:
+				CopyDimension<int32_t>(points, count, binding.offset, target, output_offset);
+				break;
+			case pdal::Dimension::Type::Signed64:
+				CopyDimension<int64_t>(points, count, binding.offset, target, output_offset);
+				break;
+			case pdal::Dimension::Type::Unsigned8:
+				CopyDimension<uint8_t>(points, count, binding.offset, target, output_offset);
+				break;
+			case pdal::Dimension::Type::Unsigned16:
+				CopyDimension<uint16_t>(points, count, binding.offset, target, output_offset);
+				break;
+			case pdal::Dimension::Type::Unsigned32:
+				CopyDimension<uint32_t>(points, count, binding.offset, target, output_offset);
+				break;
+			case pdal::Dimension::Type::Unsigned64:
+				CopyDimension<uint64_t>(points, count, binding.offset, target, output_offset);
+				break;
+			default:
+				throw InvalidInputException("Field type %d not supported", static_cast<int>(binding.type));
+			}
+		}
+		if (bindings.has_geometry) {
+			WriteGeometry(points, count, bindings, output.data[bindings.geometry_column], output_offset);
+		}
+	}
+
+	// Write the next points of a PDAL PointView into a DuckDB DataChunk, returns the number of points written.
+	static idx_t WriteViewChunk(pdal::PointView &view, pdal::PointId &point_idx, const ScanBindings &bindings,
+	                            DataChunk &output) {
+
+		const char *points[STANDARD_VECTOR_SIZE];
+		idx_t count = 0;
+
+		for (; point_idx < view.size() && count < STANDARD_VECTOR_SIZE; point_idx++) {
+			const char *point = view.getPoint(point_idx);
+
+			if (bindings.Accepts(point)) {
+				points[count++] = point;
+			}
+		}
+		WriteOutputChunk(bindings, points, count, output, 0);
+		SetConstantColumns(bindings, output);
+
+		return count;
+	}
+
+	// Write the next points of a PDAL stream into a DuckDB DataChunk, pulling new batches from the stream when
+	// the current one is consumed. Points discarded by the stages of the stream or by the spatial filter of the scan
+	// are skipped. Returns the number of points written.
+	static idx_t WriteStreamChunk(PdalPointStream &stream, pdal::PointId &batch_idx, const ScanBindings &bindings,
+	                              DataChunk &output) {
+
+		const char *points[STANDARD_VECTOR_SIZE];
+		idx_t output_size = 0;
+
+		while (output_size < STANDARD_VECTOR_SIZE) {
+			if (batch_idx >= stream.BatchSize()) {
+				if (!stream.Next()) {
 					break;
 				}
-				case pdal::Dimension::Type::Unsigned64: {
-					uint64_t value = point.getFieldAs<uint64_t>(dimId);
-					output.SetValue(col_idx, row_idx, duckdb::Value::UBIGINT(value));
-					break;
+				batch_idx = 0;
+			}
+
+			// The points of the batch must be copied before pulling the next batch, which overwrites them.
+			idx_t count = 0;
+			for (; batch_idx < stream.BatchSize() && output_size + count < STANDARD_VECTOR_SIZE; batch_idx++) {
+				if (stream.Skipped(batch_idx)) {
+					continue;
 				}
-				default:
-					throw InvalidInputException("Field type %d not supported", t);
+				const char *point = stream.GetPoint(batch_idx);
+
+				if (bindings.Accepts(point)) {
+					points[count++] = point;
 				}
-				col_idx++;
 			}
+			WriteOutputChunk(bindings, points, count, output, output_size);
+			output_size += count;
 		}
+		SetConstantColumns(bindings, output);
+
+		return output_size;
 	}
 };
 
@@ -385,7 +891,10 @@ struct PDAL_Info {
 
 	struct BindData final : TableFunctionData {
 		vector<OpenFileInfo> files;
-		explicit BindData(vector<OpenFileInfo> files_p) : files(std::move(files_p)) {
+		// Whether the files that can't be read are returned with an error message instead of being skipped.
+		bool error_column;
+		explicit BindData(vector<OpenFileInfo> files_p, bool error_column_p)
+		    : files(std::move(files_p)), error_column(error_column_p) {
 		}
 	};
 
@@ -479,245 +988,252 @@ struct PDAL_Info {
 		names.emplace_back("dimensions");
 		return_types.push_back(LogicalType::LIST(PDAL_DIMENSION_TYPE()));
 
+		// Error info
+
+		bool error_column = false;
+		const auto error_param = input.named_parameters.find("error_column");
+		if (error_param != input.named_parameters.end() && !error_param->second.IsNull()) {
+			error_column = BooleanValue::Get(error_param->second);
+		}
+		if (error_column) {
+			names.emplace_back("error");
+			return_types.push_back(LogicalType::VARCHAR);
+		}
+
 		// Get the filename list
 		const auto mfreader = MultiFileReader::Create(input.table_function);
 		const auto mflist = mfreader->CreateFileList(context, input.inputs[0], FileGlobOptions::ALLOW_EMPTY);
-		return make_uniq_base<FunctionData, BindData>(mflist->GetAllFiles());
+		return make_uniq_base<FunctionData, BindData>(mflist->GetAllFiles(), error_column);
 	}
 
 	//------------------------------------------------------------------------------------------------------------------
 	// Init Global
 	//------------------------------------------------------------------------------------------------------------------
 
-	struct State final : GlobalTableFunctionState {
-		idx_t current_idx;
-		explicit State() : current_idx(0) {
+	struct GlobalState final : GlobalTableFunctionState {
+		mutex lock;
+		idx_t next_file;
+		// Number of consecutive files of each morsel, scanned by a single thread into a single chunk.
+		idx_t morsel_size;
+		idx_t max_threads;
+
+		GlobalState(idx_t morsel_size_p, idx_t max_threads_p)
+		    : next_file(0), morsel_size(morsel_size_p), max_threads(max_threads_p) {
 		}
-	};
 
-	static unique_ptr<GlobalTableFunctionState> Init(ClientContext &context, TableFunctionInitInput &input) {
-		return make_uniq_base<GlobalTableFunctionState, State>();
-	}
+		idx_t MaxThreads() const override {
+			return max_threads;
+		}
 
-	//------------------------------------------------------------------------------------------------------------------
-	// Init Local
-	//------------------------------------------------------------------------------------------------------------------
+		// Get the next range of files to scan, returns false when all files are assigned.
+		bool NextMorsel(const BindData &bind_data, idx_t &begin, idx_t &end) {
+			lock_guard<mutex> guard(lock);
 
-	//------------------------------------------------------------------------------------------------------------------
-	// Execute
-	//------------------------------------------------------------------------------------------------------------------
-
-	static void Execute(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
+			if (next_file >= bind_data.files.size()) {
+				return false;
+			}
+			begin = next_file;
+			end = MinValue<idx_t>(begin + morsel_size, bind_data.files.size());
+			next_file = end;
+			return true;
+		}
+	};
 
+	static unique_ptr<GlobalTableFunctionState> InitGlobal(ClientContext &context, TableFunctionInitInput &input) {
 		auto &bind_data = input.bind_data->Cast<BindData>();
-		auto &state = input.global_state->Cast<State>();
 
-		// Calculate how many record we can fit in the output
-		auto output_size = MinValue<idx_t>(STANDARD_VECTOR_SIZE, bind_data.files.size() - state.current_idx);
+		// Several morsels per thread to balance the files whose header is slower to read.
+		const auto thread_count = static_cast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+		const auto file_count = bind_data.files.size();
 
-		if (output_size == 0) {
-			output.SetCardinality(0);
-			return;
+		auto morsel_size = MaxValue<idx_t>(1, file_count / MaxValue<idx_t>(1, thread_count * 4));
+		morsel_size = MinValue<idx_t>(morsel_size, STANDARD_VECTOR_SIZE);
+
+		const auto morsel_count = (file_count + morsel_size - 1) / morsel_size;
+		return make_uniq_base<GlobalTableFunctionState, GlobalState>(morsel_size, MaxValue<idx_t>(1, morsel_count));
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Init Local
+	//------------------------------------------------------------------------------------------------------------------
+
+	struct LocalState final : LocalTableFunctionState {
+		idx_t batch_index;
+		explicit LocalState() : batch_index(0) {
 		}
+	};
 
-		pdal::StageFactory stage_factory;
-
-		for (idx_t out_idx = 0; out_idx < output_size; out_idx++, state.current_idx++) {
-			auto file = bind_data.files[state.current_idx];
-			auto lower_path = StringUtil::Lower(file.path);
-
-			try {
-				pdal::Options read_options;
-				read_options.add("filename", file.path);
-
-				// Default LAS/LAZ Header fields values for the output
-
-				pdal::FixedPointTable table(5);
-				pdal::QuickInfo info = pdal::QuickInfo();
-				bool extra_header = false;
-				bool compressed = false;
-
-				std::string file_signature;
-				uint16_t file_source_id = 0;
-				uint16_t global_encoding = 0;
-				std::string project_id = "00000000-0000-0000-0000-000000000000";
-				uint8_t version_major = 0;
-				uint8_t version_minor = 0;
-				std::string system_id;
-				std::string software_id;
-				uint16_t creation_doy = 0;
-				uint16_t creation_year = 0;
-
-				uint8_t point_format = 0;
-				uint32_t point_offset = 0;
-				uint16_t point_len = 0;
-
-				double scale_x = 0.01;
-				double scale_y = 0.01;
-				double scale_z = 0.01;
-				double offset_x = 0.0;
-				double offset_y = 0.0;
-				double offset_z = 0.0;
-
-				uint32_t number_of_point_records = 0;
-				std::vector<uint64_t> number_of_points_by_return;
-
-				// Get the header data from the file
-
-				if (StringUtil::EndsWith(lower_path, ".las") || StringUtil::EndsWith(lower_path, ".laz")) {
-
-					pdal::LasReader reader;
-					reader.setOptions(read_options);
-
-					reader.prepare(table);
-					info = reader.preview();
-					const pdal::LasHeader &header = reader.header();
-
-					extra_header = true;
-					compressed = header.compressed();
-
-					file_signature = header.fileSignature();
-					file_source_id = header.fileSourceId();
-					global_encoding = header.globalEncoding();
-					project_id = header.projectId().toString();
-					version_major = header.versionMajor();
-					version_minor = header.versionMinor();
-					system_id = header.systemId();
-					software_id = header.softwareId();
-					creation_doy = header.creationDOY();
-					creation_year = header.creationYear();
-
-					point_format = header.pointFormat();
-					point_offset = header.pointOffset();
-					point_len = header.pointLen();
-
-					scale_x = header.scaleX();
-					scale_y = header.scaleY();
-					scale_z = header.scaleZ();
-					offset_x = header.offsetX();
-					offset_y = header.offsetY();
-					offset_z = header.offsetZ();
-
-					number_of_point_records = header.maxReturnCount();
-
-					for (size_t i = 0; i < number_of_point_records; i++) {
-						number_of_points_by_return.push_back(header.pointCountByReturn(i));
-					}
-				} else {
-					std::string driver = pdal::StageFactory::inferReaderDriver(file.path);
-					if (driver.length() == 0) {
-						throw InvalidInputException("File format not supported: %s", file.path);
-					}
+	static unique_ptr<LocalTableFunctionState> InitLocal(ExecutionContext &context, TableFunctionInitInput &input,
+	                                                     GlobalTableFunctionState *gstate_p) {
+		return make_uniq_base<LocalTableFunctionState, LocalState>();
+	}
 
-					pdal::Stage *reader = stage_factory.createStage(driver);
-					if (!reader) {
-						throw InvalidInputException("Driver not found for file: %s", file.path);
-					}
-					reader->setOptions(read_options);
+	//------------------------------------------------------------------------------------------------------------------
+	// Execute
+	//------------------------------------------------------------------------------------------------------------------
 
-					reader->prepare(table);
-					info = reader->preview();
+	template <class T>
+	static void SetValue(Vector &vector, idx_t row, T value) {
+		FlatVector::GetData<T>(vector)[row] = value;
+	}
 
-					stage_factory.destroyStage(reader);
-				}
+	static void SetString(Vector &vector, idx_t row, const string &value) {
+		FlatVector::GetData<string_t>(vector)[row] = StringVector::AddString(vector, value);
+	}
 
-				// Finally fill the output values
+	// Write the metadata of a file into a row of the output, directly into the vectors of the columns.
+	static void WriteRow(const PdalFileMetadata &metadata, DataChunk &output, idx_t row) {
+		// Parse the project id first, nothing is written if the metadata is invalid.
+		const hugeint_t project_id = UUID::FromString(metadata.project_id);
 
-				int attr_idx = 0;
-				output.data[attr_idx++].SetValue(out_idx, file.path);
+		// General Point Cloud fields
 
-				// General Point Cloud fields
+		idx_t attr_idx = 1;
+		SetValue<uint64_t>(output.data[attr_idx++], row, metadata.point_count);
+		SetValue<double>(output.data[attr_idx++], row, metadata.bounds.minx);
+		SetValue<double>(output.data[attr_idx++], row, metadata.bounds.miny);
+		SetValue<double>(output.data[attr_idx++], row, metadata.bounds.minz);
+		SetValue<double>(output.data[attr_idx++], row, metadata.bounds.maxx);
+		SetValue<double>(output.data[attr_idx++], row, metadata.bounds.maxy);
+		SetValue<double>(output.data[attr_idx++], row, metadata.bounds.maxz);
+		SetString(output.data[attr_idx++], row, metadata.srs_wkt);
 
-				output.data[attr_idx++].SetValue(out_idx, Value::UBIGINT(info.m_pointCount));
-				output.data[attr_idx++].SetValue(out_idx, info.m_bounds.minx);
-				output.data[attr_idx++].SetValue(out_idx, info.m_bounds.miny);
-				output.data[attr_idx++].SetValue(out_idx, info.m_bounds.minz);
-				output.data[attr_idx++].SetValue(out_idx, info.m_bounds.maxx);
-				output.data[attr_idx++].SetValue(out_idx, info.m_bounds.maxy);
-				output.data[attr_idx++].SetValue(out_idx, info.m_bounds.maxz);
-				output.data[attr_idx++].SetValue(out_idx, info.m_srs.getWKT());
+		// LAS/LAZ Header fields
 
-				// LAS/LAZ Header fields
+		SetValue<bool>(output.data[attr_idx++], row, metadata.has_las_header);
+		SetValue<bool>(output.data[attr_idx++], row, metadata.compressed);
 
-				output.data[attr_idx++].SetValue(out_idx, Value::BOOLEAN(extra_header));
-				output.data[attr_idx++].SetValue(out_idx, Value::BOOLEAN(compressed));
+		SetString(output.data[attr_idx++], row, metadata.file_signature);
+		SetValue<uint16_t>(output.data[attr_idx++], row, metadata.file_source_id);
+		SetValue<uint16_t>(output.data[attr_idx++], row, metadata.global_encoding);
+		SetValue<hugeint_t>(output.data[attr_idx++], row, project_id);
+		SetValue<uint8_t>(output.data[attr_idx++], row, metadata.version_major);
+		SetValue<uint8_t>(output.data[attr_idx++], row, metadata.version_minor);
+		SetString(output.data[attr_idx++], row, metadata.system_id);
+		SetString(output.data[attr_idx++], row, metadata.software_id);
+		SetValue<uint16_t>(output.data[attr_idx++], row, metadata.creation_doy);
+		SetValue<uint16_t>(output.data[attr_idx++], row, metadata.creation_year);
 
-				output.data[attr_idx++].SetValue(out_idx, file_signature);
-				output.data[attr_idx++].SetValue(out_idx, Value::USMALLINT(file_source_id));
-				output.data[attr_idx++].SetValue(out_idx, Value::USMALLINT(global_encoding));
-				output.data[attr_idx++].SetValue(out_idx, Value::UUID(project_id));
-				output.data[attr_idx++].SetValue(out_idx, Value::UTINYINT(version_major));
-				output.data[attr_idx++].SetValue(out_idx, Value::UTINYINT(version_minor));
-				output.data[attr_idx++].SetValue(out_idx, system_id);
-				output.data[attr_idx++].SetValue(out_idx, software_id);
-				output.data[attr_idx++].SetValue(out_idx, Value::USMALLINT(creation_doy));
-				output.data[attr_idx++].SetValue(out_idx, Value::USMALLINT(creation_year));
+		SetValue<uint8_t>(output.data[attr_idx++], row, metadata.point_format);
+		SetValue<uint32_t>(output.data[attr_idx++], row, metadata.point_offset);
+		SetValue<uint16_t>(output.data[attr_idx++], row, metadata.point_len);
 
-				output.data[attr_idx++].SetValue(out_idx, Value::UTINYINT(point_format));
-				output.data[attr_idx++].SetValue(out_idx, Value::UINTEGER(point_offset));
-				output.data[attr_idx++].SetValue(out_idx, Value::USMALLINT(point_len));
+		// Scale & Offset
 
-				// Scale & Offset
+		for (idx_t axis = 0; axis < 3; axis++) {
+			SetValue<double>(output.data[attr_idx++], row, metadata.scale[axis]);
+		}
+		for (idx_t axis = 0; axis < 3; axis++) {
+			SetValue<double>(output.data[attr_idx++], row, metadata.offset[axis]);
+		}
 
-				output.data[attr_idx++].SetValue(out_idx, scale_x);
-				output.data[attr_idx++].SetValue(out_idx, scale_y);
-				output.data[attr_idx++].SetValue(out_idx, scale_z);
-				output.data[attr_idx++].SetValue(out_idx, offset_x);
-				output.data[attr_idx++].SetValue(out_idx, offset_y);
-				output.data[attr_idx++].SetValue(out_idx, offset_z);
+		// Returns info
 
-				// Returns info
+		const auto number_of_point_records = static_cast<uint32_t>(metadata.points_by_return.size());
+		SetValue<uint32_t>(output.data[attr_idx++], row, number_of_point_records);
 
-				output.data[attr_idx++].SetValue(out_idx, Value::UINTEGER(number_of_point_records));
+		auto &returns_vector = output.data[attr_idx++];
 
-				if (number_of_point_records > 0) {
-					auto total_count = ListVector::GetListSize(output.data[attr_idx]);
-					ListVector::Reserve(output.data[attr_idx], total_count + number_of_point_records);
-					ListVector::SetListSize(output.data[attr_idx], total_count + number_of_point_records);
+		if (number_of_point_records > 0) {
+			auto total_count = ListVector::GetListSize(returns_vector);
+			ListVector::Reserve(returns_vector, total_count + number_of_point_records);
 
-					auto &ref_entry = ListVector::GetData(output.data[attr_idx])[out_idx];
-					auto &ref_vector = ListVector::GetEntry(output.data[attr_idx]);
-					ref_entry.offset = total_count;
-					ref_entry.length = number_of_point_records;
+			auto &entry = ListVector::GetData(returns_vector)[row];
+			entry.offset = total_count;
+			entry.length = number_of_point_records;
 
-					auto ref_data = FlatVector::GetData<uint64_t>(ref_vector);
+			auto ref_data = FlatVector::GetData<uint64_t>(ListVector::GetEntry(returns_vector));
+			for (idx_t i = 0; i < number_of_point_records; i++) {
+				ref_data[total_count + i] = metadata.points_by_return[i];
+			}
+			ListVector::SetListSize(returns_vector, total_count + number_of_point_records);
+		} else {
+			FlatVector::SetNull(returns_vector, row, true);
+		}
 
-					for (size_t i = 0; i < number_of_point_records; i++) {
-						ref_data[total_count + i] = number_of_points_by_return[i];
-					}
-					attr_idx++;
-				} else {
-					FlatVector::SetNull(output.data[attr_idx], out_idx, true);
-					attr_idx++;
-				}
+		// Dimensions info
 
-				// Dimensions info
+		auto &dimensions_vector = output.data[attr_idx++];
+		const auto dimension_count = metadata.dimensions.size();
+		auto total_count = ListVector::GetListSize(dimensions_vector);
+		ListVector::Reserve(dimensions_vector, total_count + dimension_count);
 
-				std::vector<duckdb::Value> dimensions;
-				pdal::PointLayoutPtr layout = table.layout();
+		auto &entry = ListVector::GetData(dimensions_vector)[row];
+		entry.offset = total_count;
+		entry.length = dimension_count;
 
-				for (const auto &dimId : layout->dims()) {
-					std::string name = layout->dimName(dimId);
-					const pdal::Dimension::Detail *detail = layout->dimDetail(dimId);
-					pdal::Dimension::Type t = detail->type();
+		auto &struct_entries = StructVector::GetEntries(ListVector::GetEntry(dimensions_vector));
+		for (idx_t i = 0; i < dimension_count; i++) {
+			const auto &dimension = metadata.dimensions[i];
+			SetString(*struct_entries[0], total_count + i, dimension.first);
+			SetString(*struct_entries[1], total_count + i, pdal::Dimension::interpretationName(dimension.second));
+		}
+		ListVector::SetListSize(dimensions_vector, total_count + dimension_count);
+	}
 
-					child_list_t<Value> struct_entry;
-					struct_entry.emplace_back("name", Value(name));
-					struct_entry.emplace_back("type", Value(pdal::Dimension::interpretationName(t)));
-					dimensions.push_back(Value::STRUCT(struct_entry));
+	static void Execute(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
+		auto &bind_data = input.bind_data->Cast<BindData>();
+		auto &gstate = input.global_state->Cast<GlobalState>();
+		auto &lstate = input.local_state->Cast<LocalState>();
+
+		// Scan the files of the next morsel, skipping the morsels whose files can't be opened if errors are not
+		// reported.
+		idx_t output_size = 0;
+		idx_t begin, end;
+
+		while (output_size == 0 && gstate.NextMorsel(bind_data, begin, end)) {
+			lstate.batch_index = begin / gstate.morsel_size;
+
+			for (idx_t file_idx = begin; file_idx < end; file_idx++) {
+				const auto &file = bind_data.files[file_idx];
+				string error;
+
+				try {
+					// Get the header data from the file, cached while the file is unchanged.
+					const auto metadata = PdalMetadataCache::Get(context)->GetMetadata(context, file.path);
+					WriteRow(*metadata, output, output_size);
+				} catch (std::exception &ex) {
+					error = ErrorData(ex).RawMessage();
 				}
-				output.data[attr_idx++].SetValue(out_idx, Value::LIST(PDAL_DIMENSION_TYPE(), std::move(dimensions)));
 
-			} catch (...) {
-				// Just skip anything we cant open
-				out_idx--;
-				output_size--;
-				continue;
+				if (!error.empty() && !bind_data.error_column) {
+					// Just skip anything we cant open
+					continue;
+				}
+				SetString(output.data[0], output_size, file.path);
+
+				if (bind_data.error_column) {
+					auto &error_vector = output.data[output.ColumnCount() - 1];
+
+					if (error.empty()) {
+						FlatVector::SetNull(error_vector, output_size, true);
+					} else {
+						// The metadata columns of a file that can't be opened are NULL
+						for (idx_t col_idx = 1; col_idx + 1 < output.ColumnCount(); col_idx++) {
+							FlatVector::SetNull(output.data[col_idx], output_size, true);
+						}
+						SetString(error_vector, output_size, error);
+					}
+				}
+				output_size++;
 			}
 		}
 		output.SetCardinality(output_size);
 	}
 
+	//------------------------------------------------------------------------------------------------------------------
+	// Partition Data
+	//------------------------------------------------------------------------------------------------------------------
+
+	// The morsel of each chunk is used as batch index, so the files are returned in order when scanned in parallel.
+	static OperatorPartitionData GetPartitionData(ClientContext &context, TableFunctionGetPartitionInput &input) {
+		if (input.partition_info.RequiresPartitionColumns()) {
+			throw InternalException("PDAL_Info::GetPartitionData: partition columns not supported");
+		}
+		auto &lstate = input.local_state->Cast<LocalState>();
+		return OperatorPartitionData(lstate.batch_index);
+	}
+
 	//------------------------------------------------------------------------------------------------------------------
 	// Cardinality
 	//------------------------------------------------------------------------------------------------------------------
@@ -734,6 +1250,9 @@ struct PDAL_Info {
 		Read the metadata from a point cloud file.
 
 		The `PDAL_Info` table function accompanies the `PDAL_Read` table function, but instead of reading the contents of a file, this function scans the metadata instead.
+
+		The files are scanned in parallel. Files that can't be read are skipped, unless `error_column => true` is given:
+		then they are returned with NULL metadata and the reason of the failure in an additional `error` column.
 	)";
 
 	static constexpr auto EXAMPLE = R"(
@@ -750,172 +1269,167 @@ struct PDAL_Info {
 		tags.insert("ext", "pdal");
 		tags.insert("category", "table");
 
-		const TableFunction func("PDAL_Info", {LogicalType::VARCHAR}, Execute, Bind, Init);
+		TableFunction func("PDAL_Info", {LogicalType::VARCHAR}, Execute, Bind, InitGlobal, InitLocal);
+
+		func.get_partition_data = GetPartitionData;
+		func.named_parameters["error_column"] = LogicalType::BOOLEAN;
 
 		RegisterFunction<TableFunction>(loader, func, CatalogType::TABLE_FUNCTION_ENTRY, DESCRIPTION, EXAMPLE, tags);
 	}
 };
 
 //======================================================================================================================
-// PDAL_Read
+// PDAL_MetadataCache
 //======================================================================================================================
 
-struct PDAL_Read {
+struct PDAL_MetadataCache {
 
 	//------------------------------------------------------------------------------------------------------------------
 	// Bind
 	//------------------------------------------------------------------------------------------------------------------
 
-	struct BindData final : TableFunctionData {
-		string file_name;
-		std::unique_ptr<pdal::StageFactory> stage_factory;
-		std::unique_ptr<pdal::PointTable> table;
-		pdal::PointViewSet views;
-		uint64_t point_count = 0;
-	};
-
 	static unique_ptr<FunctionData> Bind(ClientContext &context, TableFunctionBindInput &input,
 	                                     vector<LogicalType> &return_types, vector<string> &names) {
 
-		auto file_name = StringValue::Get(input.inputs[0]);
-
-		if (!pdal::FileUtils::fileExists(file_name)) {
-			throw InvalidInputException("File not found: %s", file_name);
-		}
-
-		std::string driver = pdal::StageFactory::inferReaderDriver(file_name);
-		if (driver.length() == 0) {
-			throw InvalidInputException("File format not supported: %s", file_name);
-		}
-
-		// Create the PDAL reader based on file extension and set reader options.
-
-		std::unique_ptr<pdal::StageFactory> stage_factory = std::make_unique<pdal::StageFactory>();
+		names.emplace_back("file_name");
+		return_types.push_back(LogicalType::VARCHAR);
+		names.emplace_back("driver");
+		return_types.push_back(LogicalType::VARCHAR);
+		names.emplace_back("file_size");
+		return_types.push_back(LogicalType::BIGINT);
+		names.emplace_back("last_modified");
+		return_types.push_back(LogicalType::TIMESTAMP);
+		names.emplace_back("point_count");
+		return_types.push_back(LogicalType::UBIGINT);
 
-		pdal::Stage *reader = stage_factory->createStage(driver);
-		if (!reader) {
-			throw InvalidInputException("Driver not found for file: %s", file_name);
-		}
+		return make_uniq<TableFunctionData>();
+	}
 
-		pdal::Options reader_options;
-		reader_options.add("filename", file_name);
+	//------------------------------------------------------------------------------------------------------------------
+	// Init
+	//------------------------------------------------------------------------------------------------------------------
 
-		auto options_param = input.named_parameters.find("options");
-		if (options_param != input.named_parameters.end()) {
-			const std::vector<duckdb::Value> &children = MapValue::GetChildren(options_param->second);
-			PDAL_Utils::ParseOptions(children, reader_options);
+	struct State final : GlobalTableFunctionState {
+		std::vector<PdalMetadataCache::Entry> entries;
+		idx_t current_idx;
+		explicit State(std::vector<PdalMetadataCache::Entry> entries_p)
+		    : entries(std::move(entries_p)), current_idx(0) {
 		}
+	};
 
-		reader->setOptions(reader_options);
-
-		// Make the PDAL PointTable where layout is stored, and set the output schema.
-
-		std::unique_ptr<pdal::PointTable> table = std::make_unique<pdal::PointTable>();
-		reader->prepare(*table);
-
-		pdal::PointLayoutPtr layout = table->layout();
-		PDAL_Utils::ExtractLayout(layout, return_types, names);
+	// The entries are copied when the scan starts, the cache may change meanwhile.
+	static unique_ptr<GlobalTableFunctionState> Init(ClientContext &context, TableFunctionInitInput &input) {
+		return make_uniq_base<GlobalTableFunctionState, State>(PdalMetadataCache::Get(context)->Entries());
+	}
 
-		// Load the point data into a PointViewSet.
+	//------------------------------------------------------------------------------------------------------------------
+	// Execute
+	//------------------------------------------------------------------------------------------------------------------
 
-		pdal::PointViewSet views = reader->execute(*table);
-		pdal::point_count_t point_count = reader->preview().m_pointCount;
+	static void Execute(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
+		auto &state = input.global_state->Cast<State>();
 
-		// Create and return bind data.
+		idx_t count = 0;
+		auto next_idx = MinValue<idx_t>(state.current_idx + STANDARD_VECTOR_SIZE, state.entries.size());
 
-		auto result = make_uniq<BindData>();
-		result->file_name = file_name;
-		result->stage_factory = std::move(stage_factory);
-		result->table = std::move(table);
-		result->views = std::move(views);
-		result->point_count = point_count;
+		for (; state.current_idx < next_idx; state.current_idx++) {
+			const auto &entry = state.entries[state.current_idx];
 
-		return std::move(result);
-	};
+			output.data[0].SetValue(count, entry.file_name);
+			output.data[1].SetValue(count, entry.metadata->driver);
+			output.data[2].SetValue(count, Value::BIGINT(entry.file_size));
+			output.data[3].SetValue(count, Value::TIMESTAMP(entry.last_modified));
+			output.data[4].SetValue(count, Value::UBIGINT(entry.metadata->point_count));
+			count++;
+		}
+		output.SetCardinality(count);
+	}
 
 	//------------------------------------------------------------------------------------------------------------------
-	// Init Global
+	// Documentation
 	//------------------------------------------------------------------------------------------------------------------
 
-	struct GlobalState final : GlobalTableFunctionState {
-		pdal::PointId point_idx;
-		explicit GlobalState(ClientContext &context) : point_idx(0) {
-		}
-	};
+	static constexpr auto DESCRIPTION = R"(
+		Returns the files in the metadata cache of the database, from the most to the least recently used.
 
-	static unique_ptr<GlobalTableFunctionState> InitGlobal(ClientContext &context, TableFunctionInitInput &input) {
-		auto result = make_uniq<GlobalState>(context);
-		return std::move(result);
-	}
+		PDAL_Read and PDAL_Info cache the metadata read from the header of each file (layout, bounds, SRS and LAS
+		header fields), it is used while the size and the modification time of the file are unchanged. The
+		pdal_metadata_cache_size setting sets the maximum number of cached files, 0 disables the cache.
+	)";
 
-	//------------------------------------------------------------------------------------------------------------------
-	// Init Local
-	//------------------------------------------------------------------------------------------------------------------
+	static constexpr auto EXAMPLE = R"(
+		SELECT file_name, point_count FROM PDAL_MetadataCache();
+		SET pdal_metadata_cache_size = 10000;
+	)";
 
 	//------------------------------------------------------------------------------------------------------------------
-	// Execute
+	// Register
 	//------------------------------------------------------------------------------------------------------------------
 
-	static void Execute(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
-		auto &bind_data = (BindData &)*input.bind_data;
-		auto &gstate = input.global_state->Cast<GlobalState>();
+	static void Register(ExtensionLoader &loader) {
 
-		// Calculate how many record we can fit in the output
-		const auto output_size = std::min<idx_t>(STANDARD_VECTOR_SIZE, bind_data.point_count - gstate.point_idx);
-		const auto record_start = gstate.point_idx;
+		InsertionOrderPreservingMap<string> tags;
+		tags.insert("ext", "pdal");
+		tags.insert("category", "table");
 
-		if (output_size == 0) {
-			output.SetCardinality(0);
-			return;
-		}
+		const TableFunction func("PDAL_MetadataCache", {}, Execute, Bind, Init);
+		RegisterFunction<TableFunction>(loader, func, CatalogType::TABLE_FUNCTION_ENTRY, DESCRIPTION, EXAMPLE, tags);
 
-		// Load current subset of points into the output.
-		pdal::PointViewPtr view = *(bind_data.views.begin());
-		PDAL_Utils::WriteOutputChunk(view, record_start, output_size, output);
+		// Setting of the size of the cache
+		auto &config = DBConfig::GetConfig(loader.GetDatabaseInstance());
+		config.AddExtensionOption(PdalMetadataCache::CAPACITY_SETTING,
+		                          "Maximum number of files in the PDAL metadata cache of the database, 0 disables it",
+		                          LogicalType::UBIGINT, Value::UBIGINT(PdalMetadataCache::DEFAULT_CAPACITY));
+	}
+};
 
-		// Update the point index
-		gstate.point_idx += output_size;
+//======================================================================================================================
+// PDAL_ClearMetadataCache
+//======================================================================================================================
 
-		// Set the cardinality of the output
-		output.SetCardinality(output_size);
-	};
+struct PDAL_ClearMetadataCache {
 
 	//------------------------------------------------------------------------------------------------------------------
-	// Cardinality
+	// Bind
 	//------------------------------------------------------------------------------------------------------------------
 
-	static unique_ptr<NodeStatistics> Cardinality(ClientContext &context, const FunctionData *data) {
-
-		auto &bind_data = data->Cast<BindData>();
-		auto result = make_uniq<NodeStatistics>();
+	static unique_ptr<FunctionData> Bind(ClientContext &context, TableFunctionBindInput &input,
+	                                     vector<LogicalType> &return_types, vector<string> &names) {
 
-		// This is the maximum number of points in a single file
-		result->has_max_cardinality = true;
-		result->max_cardinality = bind_data.point_count;
+		names.emplace_back("removed_entries");
+		return_types.push_back(LogicalType::UBIGINT);
 
-		return result;
+		return make_uniq<TableFunctionData>();
 	}
 
 	//------------------------------------------------------------------------------------------------------------------
-	// Replacement Scan
+	// Init
 	//------------------------------------------------------------------------------------------------------------------
 
-	static unique_ptr<TableRef> ReplacementScan(ClientContext &, ReplacementScanInput &input,
-	                                            optional_ptr<ReplacementScanData>) {
-		auto &table_name = input.table_name;
-		auto lower_name = StringUtil::Lower(table_name);
+	struct State final : GlobalTableFunctionState {
+		bool finished;
+		explicit State() : finished(false) {
+		}
+	};
 
-		// Check if the file name ends with some common LiDAR file extensions
-		if (StringUtil::EndsWith(lower_name, ".las") || StringUtil::EndsWith(lower_name, ".laz")) {
+	static unique_ptr<GlobalTableFunctionState> Init(ClientContext &context, TableFunctionInitInput &input) {
+		return make_uniq_base<GlobalTableFunctionState, State>();
+	}
 
-			auto table_function = make_uniq<TableFunctionRef>();
-			vector<unique_ptr<ParsedExpression>> children;
-			children.push_back(make_uniq<ConstantExpression>(Value(table_name)));
-			table_function->function = make_uniq<FunctionExpression>("PDAL_Read", std::move(children));
-			return std::move(table_function);
+	//------------------------------------------------------------------------------------------------------------------
+	// Execute
+	//------------------------------------------------------------------------------------------------------------------
+
+	static void Execute(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
+		auto &state = input.global_state->Cast<State>();
+
+		if (state.finished) {
+			output.SetCardinality(0);
+			return;
 		}
-		// else not something we can replace
-		return nullptr;
+		output.data[0].SetValue(0, Value::UBIGINT(PdalMetadataCache::Get(context)->Clear()));
+		output.SetCardinality(1);
+		state.finished = true;
 	}
 
 	//------------------------------------------------------------------------------------------------------------------
@@ -923,27 +1437,11 @@ struct PDAL_Read {
 	//------------------------------------------------------------------------------------------------------------------
 
 	static constexpr auto DESCRIPTION = R"(
-		Read and import a variety of point cloud data file formats using the PDAL library.
+		Removes all the files from the metadata cache of the database, returning the number of removed entries.
 	)";
 
 	static constexpr auto EXAMPLE = R"(
-		SELECT * FROM PDAL_Read('path/to/your/filename.las') LIMIT 10;
-
-		┌───────────┬───────────┬────────┐
-		│     X     │     Y     │   Z    │
-		│   double  │   double  │ double │
-		├───────────┼───────────┼────────┤
-		│ 637177.98 │ 849393.95 │ 411.19 │
-		│ 637177.30 │ 849396.95 │ 411.25 │
-		│ 637176.34 │ 849400.84 │ 411.01 │
-		│ 637175.45 │ 849404.62 │ 410.99 │
-		│ 637174.33 │ 849407.37 │ 411.38 │
-		└───────────┴───────────┴────────┘
-
-		SELECT * FROM PDAL_Read('path/to/your/filename.las', options => MAP {'start': 10});
-
-		Optional Options parameter can be used to pass reader-specific options as key-value pairs.
-		For example, for the LAS/LAZ reader, the options are documented at https://pdal.io/en/stable/stages/readers.las.html#options
+		CALL PDAL_ClearMetadataCache();
 	)";
 
 	//------------------------------------------------------------------------------------------------------------------
@@ -956,117 +1454,573 @@ struct PDAL_Read {
 		tags.insert("ext", "pdal");
 		tags.insert("category", "table");
 
-		TableFunction func("PDAL_Read", {LogicalType::VARCHAR}, Execute, Bind, InitGlobal);
-
-		func.cardinality = Cardinality;
-		func.named_parameters["options"] = LogicalType::MAP(LogicalType::VARCHAR, LogicalType::VARCHAR);
-
+		const TableFunction func("PDAL_ClearMetadataCache", {}, Execute, Bind, Init);
 		RegisterFunction<TableFunction>(loader, func, CatalogType::TABLE_FUNCTION_ENTRY, DESCRIPTION, EXAMPLE, tags);
-
-		// Replacement scan
-		auto &db = loader.GetDatabaseInstance();
-		auto &config = DBConfig::GetConfig(db);
-		config.replacement_scans.emplace_back(ReplacementScan);
 	}
 };
 
 //======================================================================================================================
-// PDAL_Pipeline
+// PDAL_Read
 //======================================================================================================================
 
-struct PDAL_Pipeline {
+struct PDAL_Read {
 
 	//------------------------------------------------------------------------------------------------------------------
 	// Bind
 	//------------------------------------------------------------------------------------------------------------------
 
-	struct BindData final : TableFunctionData {
+	// A point cloud file of the scan.
+	struct FileData {
 		string file_name;
-		std::unique_ptr<pdal::PipelineManager> pipeline;
+		std::string driver;
+		bool streamable = false;
+		// Number of points from the header of the file, only known if the reader provides a summary of the file.
+		bool has_point_count = false;
 		uint64_t point_count = 0;
-	};
-
-	static unique_ptr<FunctionData> Bind(ClientContext &context, TableFunctionBindInput &input,
-	                                     vector<LogicalType> &return_types, vector<string> &names) {
-
-		auto file_name = StringValue::Get(input.inputs[0]);
-		auto the_pipeline = StringValue::Get(input.inputs[1]);
-
-		if (!pdal::FileUtils::fileExists(file_name)) {
-			throw InvalidInputException("File not found: %s", file_name);
+		// Number of points of each morsel of the file, zero if the file is scanned as a whole by a single thread.
+		uint64_t morsel_size = 0;
+		// Number of tiles along X and Y of the morsels of COPC files, zero if the file is not split in tiles.
+		idx_t tiles_per_axis = 0;
+		// True if the reader returns exactly the number of points of the header.
+		bool exact_point_count = false;
+		// Values of the hive partitions of the file path, in the order of the partition columns.
+		vector<Value> partition_values;
+		// Bounds of the points from the header of the file, unbounded if the reader does not provide them.
+		PDAL_Utils::BoundingBox bounds;
+
+		// Scale and offset of the X/Y/Z coordinates from the LAS header.
+		bool has_scale = false;
+		double scale[3];
+		double offset[3];
+
+		// Column statistics from the LAS header. The bounds are widened by one scale unit, as writers may round
+		// them, and the return numbers come from the point counts by return.
+		bool has_statistics = false;
+		PDAL_Utils::BoundingBox statistics_bounds;
+		uint8_t min_return_number = 0;
+		uint8_t max_return_number = 0;
+
+		// Bounds used to prune the file, the widened ones of the statistics if the header provides them.
+		const PDAL_Utils::BoundingBox &PruningBounds() const {
+			return has_statistics ? statistics_bounds : bounds;
 		}
 
-		std::string driver = pdal::StageFactory::inferReaderDriver(file_name);
-		if (driver.length() == 0) {
-			throw InvalidInputException("File format not supported: %s", file_name);
+		idx_t MorselCount() const {
+			if (tiles_per_axis > 0) {
+				return tiles_per_axis * tiles_per_axis;
+			}
+			return morsel_size == 0 ? 1 : MaxValue<idx_t>(1, (point_count + morsel_size - 1) / morsel_size);
 		}
 
-		// Create the PDAL Pipeline Manager and read the pipeline definition (inline JSON or file).
+		// Get the XY tile of a morsel of a COPC file. The tiles are half-open and the outer ones unbounded, so
+		// each point belongs to exactly one tile.
+		PDAL_Utils::BoundingBox GetTile(idx_t range_idx) const {
+			PDAL_Utils::BoundingBox tile;
+			if (tiles_per_axis == 0) {
+				return tile;
+			}
+			const idx_t tile_xy[2] = {range_idx % tiles_per_axis, range_idx / tiles_per_axis};
 
-		std::unique_ptr<pdal::PipelineManager> pipeline = std::make_unique<pdal::PipelineManager>();
+			for (idx_t axis = 0; axis < 2; axis++) {
+				const double step = (bounds.upper[axis] - bounds.lower[axis]) / static_cast<double>(tiles_per_axis);
 
-		if (StringUtil::StartsWith(the_pipeline, "[") && StringUtil::EndsWith(the_pipeline, "]")) {
-			std::stringstream ssin(the_pipeline);
-			pipeline->readPipeline(ssin);
-		} else {
-			if (!pdal::FileUtils::fileExists(the_pipeline)) {
-				throw InvalidInputException("Pipeline file not found: %s", the_pipeline);
+				if (tile_xy[axis] > 0) {
+					tile.lower[axis] = bounds.lower[axis] + step * static_cast<double>(tile_xy[axis]);
+				}
+				if (tile_xy[axis] + 1 < tiles_per_axis) {
+					const double upper = bounds.lower[axis] + step * static_cast<double>(tile_xy[axis] + 1);
+					tile.upper[axis] = std::nextafter(upper, -std::numeric_limits<double>::infinity());
+				}
 			}
-			pipeline->readPipeline(the_pipeline);
-		}
-
-		std::vector<pdal::Stage *> roots = pipeline->roots();
-		if (roots.size() > 1) {
-			throw InvalidInputException("Can't process pipeline with more than one root.");
+			return tile;
 		}
-		if (roots.size() == 0) {
-			throw InvalidInputException("Pipeline has no root stage.");
-		}
-
-		// Create the PDAL reader based on file extension and set reader options.
+	};
 
+	struct BindData final : TableFunctionData {
+		vector<FileData> files;
 		pdal::Options reader_options;
-		reader_options.add("filename", file_name);
+		// Names of the dimensions of the output, the union of the dimensions of all files. The file name and the
+		// hive partition columns follow them.
+		vector<string> names;
+		bool filename_column = false;
+		vector<string> partition_names;
+		uint64_t point_count = 0;
+		// Box of the X/Y/Z range filters of the query, pushed down from the optimizer.
+		PDAL_Utils::BoundingBox filter_box;
+		// Resolution of the points to read from COPC/EPT octrees, zero to read the full resolution.
+		double resolution = 0;
+		// Encoding of the X/Y/Z coordinates of LAS/LAZ files.
+		PDAL_Utils::CoordinateEncoding coordinates = PDAL_Utils::CoordinateEncoding::DOUBLE;
+		// Column id of the geometry column, the last of the output.
+		column_t geometry_id = DConstants::INVALID_INDEX;
+		// Number of points above which the files are split into morsels, and the number of points of each morsel.
+		uint64_t morsel_size = MORSEL_SIZE;
+	};
 
-		auto options_param = input.named_parameters.find("options");
-		if (options_param != input.named_parameters.end()) {
-			const std::vector<duckdb::Value> &children = MapValue::GetChildren(options_param->second);
-			PDAL_Utils::ParseOptions(children, reader_options);
-		}
+	// Number of points of the morsels of LAS/LAZ files, a multiple of the default LAZ chunk size (50000 points) so
+	// that the readers of compressed files start decoding at a chunk boundary. The chunk table of the files is not
+	// read, LAZ files with other chunk sizes are still read correctly but decode part of a chunk twice per morsel.
+	static constexpr uint64_t MORSEL_SIZE = 1000000;
 
-		pdal::Stage *reader = &pipeline->makeReader(file_name, driver, reader_options);
-		roots[0]->setInput(*reader);
+	// Returns true if the driver reads an octree, where the nodes outside of the bounds to read are skipped.
+	static bool IsOctreeDriver(const std::string &driver) {
+		return driver == "readers.copc" || driver == "readers.ept";
+	}
 
-		// Run the PDAL pipeline from the JSON file.
+	// Create the PDAL reader of a file and set the reader options, to read the points of the range or of the box.
+	// The reader is created by the plugin manager of PDAL, which owns the registry of the drivers, without building
+	// a stage factory per call.
+	static std::unique_ptr<pdal::Stage> CreateReader(const BindData &bind_data, const FileData &file,
+	                                                 idx_t range_idx = 0,
+	                                                 const PDAL_Utils::BoundingBox &box = PDAL_Utils::BoundingBox()) {
 
-		pdal::point_count_t point_count = pipeline->execute();
-		pdal::PointViewPtr view = *(pipeline->views().begin());
+		std::unique_ptr<pdal::Stage> reader = pdal::PluginManager<pdal::Stage>::createObject(file.driver);
+		if (!reader) {
+			throw InvalidInputException("Driver not found for file: %s", file.file_name);
+		}
+		pdal::Options reader_options = bind_data.reader_options;
+		reader_options.add("filename", file.file_name);
 
-		pdal::PointLayoutPtr layout = view->layout();
-		PDAL_Utils::ExtractLayout(layout, return_types, names);
+		// Readers of indexed formats only load the nodes intersecting the box.
+		if (IsOctreeDriver(file.driver)) {
+			if (box.IsBounded() && !box.IsEmpty() && !reader_options.hasOption("bounds")) {
+				reader_options.add("bounds", box.ToBoundsOption());
+			}
+			if (bind_data.resolution > 0 && !reader_options.hasOption("resolution")) {
+				reader_options.add("resolution", bind_data.resolution);
+			}
+		}
+		// Read only the range of points of the morsel.
+		if (file.morsel_size > 0) {
+			reader_options.add("start", range_idx * file.morsel_size);
+			reader_options.add("count", file.morsel_size);
+		}
+		reader->setOptions(reader_options);
+		return reader;
+	}
 
-		// Create and return bind data.
+	// Read the scale and offset of the coordinates of a file from its LAS header.
+	static void ReadHeaderScale(const PdalFileMetadata &metadata, FileData &file_data) {
+		for (idx_t axis = 0; axis < 3; axis++) {
+			file_data.scale[axis] = metadata.scale[axis];
+			file_data.offset[axis] = metadata.offset[axis];
+		}
+		file_data.has_scale = true;
+	}
 
-		auto result = make_uniq<BindData>();
-		result->file_name = file_name;
-		result->pipeline = std::move(pipeline);
-		result->point_count = point_count;
+	// Read the column statistics of a file from its LAS header.
+	static void ReadHeaderStatistics(const PdalFileMetadata &metadata, FileData &file_data) {
 
-		return std::move(result);
+		for (idx_t axis = 0; axis < 3; axis++) {
+			file_data.statistics_bounds.Restrict(axis, file_data.bounds.lower[axis] - std::abs(file_data.scale[axis]),
+			                                     file_data.bounds.upper[axis] + std::abs(file_data.scale[axis]));
+		}
+
+		// The counts by return are only reliable if they add up to the number of points.
+		uint64_t return_total = 0;
+		for (idx_t i = 0; i < metadata.points_by_return.size(); i++) {
+			const auto return_count = metadata.points_by_return[i];
+			if (return_count > 0) {
+				const auto return_number = static_cast<uint8_t>(i + 1);
+				if (!file_data.min_return_number) {
+					file_data.min_return_number = return_number;
+				}
+				file_data.max_return_number = return_number;
+			}
+			return_total += return_count;
+		}
+		if (return_total != metadata.header_point_count) {
+			file_data.min_return_number = 0;
+			file_data.max_return_number = 0;
+		}
+		file_data.has_statistics = true;
+	}
+
+	// Get an upper bound of the absolute value of the integers of a coordinate of a file at its scale, from the range
+	// of the int32 integers of the LAS format and from the header bounds.
+	static double MaxScaledCoordinate(const FileData &file, idx_t axis) {
+		const double scale = std::abs(file.scale[axis]);
+		double max_value = std::abs(file.offset[axis]) + scale * 2147483648.0;
+
+		const double lower = file.bounds.lower[axis];
+		const double upper = file.bounds.upper[axis];
+		if (std::isfinite(lower) && std::isfinite(upper)) {
+			max_value = MaxValue(max_value, MaxValue(std::abs(lower), std::abs(upper)));
+		}
+		return max_value / scale;
+	}
+
+	// Set the types of the X/Y/Z columns for the raw or decimal coordinates. Raw integers are only comparable when all
+	// files share the same scale and offset, decimals when all files share the same scale. The decimals are widened
+	// when the scaled integers of a file may not fit in 18 digits, e.g. a scale of 1e-9 with coordinates above 1e9.
+	static void BindCoordinateTypes(const BindData &bind_data, vector<LogicalType> &return_types) {
+		const auto raw = bind_data.coordinates == PDAL_Utils::CoordinateEncoding::RAW;
+
+		for (idx_t col_idx = 0; col_idx < bind_data.names.size(); col_idx++) {
+			const auto axis = PDAL_Utils::CoordinateAxis(bind_data.names[col_idx]);
+			if (axis < 0 || return_types[col_idx] != LogicalType::DOUBLE) {
+				continue;
+			}
+			uint8_t digits = 0;
+			uint8_t width = PDAL_Utils::COORDINATE_DECIMAL_WIDTH;
+
+			for (idx_t file_idx = 0; file_idx < bind_data.files.size(); file_idx++) {
+				const auto &file = bind_data.files[file_idx];
+				const auto &first = bind_data.files[0];
+
+				if (!file.has_scale) {
+					throw InvalidInputException("Raw or decimal coordinates require LAS/LAZ files: %s", file.file_name);
+				}
+				if (file.scale[axis] != first.scale[axis] || (raw && file.offset[axis] != first.offset[axis])) {
+					throw InvalidInputException("Scale or offset of '%s' in file '%s' differs from file '%s'",
+					                            bind_data.names[col_idx], file.file_name, first.file_name);
+				}
+				if (!raw && !PDAL_Utils::TryGetScaleDigits(file.scale[axis], digits)) {
+					throw InvalidInputException("Decimal coordinates require a power of ten scale, '%s' is %f in: %s",
+					                            bind_data.names[col_idx], file.scale[axis], file.file_name);
+				}
+				if (!raw && MaxScaledCoordinate(file, axis) >= 1e18) {
+					width = PDAL_Utils::COORDINATE_WIDE_DECIMAL_WIDTH;
+				}
+			}
+			return_types[col_idx] = raw ? LogicalType::INTEGER : LogicalType::DECIMAL(width, digits);
+		}
+	}
+
+	// Detect the type of a hive partition like DuckDB does, the first of DATE, TIMESTAMP and BIGINT all the values
+	// of the files cast to, otherwise VARCHAR. The values of the files are cast to the detected type.
+	static LogicalType DetectPartitionType(ClientContext &context, vector<FileData> &files, idx_t partition_idx) {
+		const LogicalType candidates[] = {LogicalType::DATE, LogicalType::TIMESTAMP, LogicalType::BIGINT};
+
+		for (const auto &candidate : candidates) {
+			vector<Value> values;
+
+			for (const auto &file : files) {
+				Value value(candidate);
+				const auto &partition_value = file.partition_values[partition_idx];
+
+				if (!partition_value.IsNull() && !partition_value.TryCastAs(context, candidate, value, nullptr, true)) {
+					break;
+				}
+				values.push_back(std::move(value));
+			}
+			if (values.size() < files.size()) {
+				continue;
+			}
+			for (idx_t file_idx = 0; file_idx < files.size(); file_idx++) {
+				files[file_idx].partition_values[partition_idx] = std::move(values[file_idx]);
+			}
+			return candidate;
+		}
+		return LogicalType::VARCHAR;
+	}
+
+	// Detect the hive partitions like read_parquet does when the hive_partitioning parameter is not set: all the files
+	// must have the same partitions. Partitions named like a column of the point clouds are not detected, e.g. the
+	// Classification=2 directories written by PARTITION_BY (Classification).
+	static bool DetectHivePartitioning(const BindData &bind_data, const unordered_map<string, idx_t> &dimension_map) {
+		if (bind_data.files.empty()) {
+			return false;
+		}
+		const auto first_partitions = HivePartitioning::Parse(bind_data.files[0].file_name);
+		if (first_partitions.empty()) {
+			return false;
+		}
+		for (const auto &partition : first_partitions) {
+			if (dimension_map.count(partition.first) || (bind_data.filename_column && partition.first == "filename")) {
+				return false;
+			}
+		}
+		for (const auto &file_data : bind_data.files) {
+			const auto partitions = HivePartitioning::Parse(file_data.file_name);
+
+			if (partitions.size() != first_partitions.size()) {
+				return false;
+			}
+			for (const auto &partition : first_partitions) {
+				if (!partitions.count(partition.first)) {
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	static unique_ptr<FunctionData> Bind(ClientContext &context, TableFunctionBindInput &input,
+	                                     vector<LogicalType> &return_types, vector<string> &names) {
+
+		auto result = make_uniq<BindData>();
+
+		auto options_param = input.named_parameters.find("options");
+		if (options_param != input.named_parameters.end()) {
+			const std::vector<duckdb::Value> &children = MapValue::GetChildren(options_param->second);
+			PDAL_Utils::ParseOptions(children, result->reader_options);
+		}
+		bool hive_partitioning = false;
+		bool auto_hive_partitioning = true;
+
+		auto filename_param = input.named_parameters.find("filename");
+		if (filename_param != input.named_parameters.end()) {
+			result->filename_column = BooleanValue::Get(filename_param->second);
+		}
+		auto hive_param = input.named_parameters.find("hive_partitioning");
+		if (hive_param != input.named_parameters.end()) {
+			hive_partitioning = BooleanValue::Get(hive_param->second);
+			auto_hive_partitioning = false;
+		}
+		bool geometry_column = false;
+
+		auto geometry_param = input.named_parameters.find("geometry");
+		if (geometry_param != input.named_parameters.end()) {
+			geometry_column = BooleanValue::Get(geometry_param->second);
+		}
+		auto coordinates_param = input.named_parameters.find("coordinates");
+		if (coordinates_param != input.named_parameters.end()) {
+			auto coordinates = StringUtil::Lower(StringValue::Get(coordinates_param->second));
+			if (coordinates == "raw") {
+				result->coordinates = PDAL_Utils::CoordinateEncoding::RAW;
+			} else if (coordinates == "decimal") {
+				result->coordinates = PDAL_Utils::CoordinateEncoding::DECIMAL;
+			} else if (coordinates != "double") {
+				throw InvalidInputException("Invalid coordinates '%s', expected 'double', 'raw' or 'decimal'",
+				                            coordinates);
+			}
+		}
+		auto resolution_param = input.named_parameters.find("resolution");
+		if (resolution_param != input.named_parameters.end()) {
+			result->resolution = DoubleValue::Get(resolution_param->second);
+			if (result->resolution < 0) {
+				throw InvalidInputException("Resolution must be a positive number");
+			}
+		}
+		auto morsel_size_param = input.named_parameters.find("morsel_size");
+		if (morsel_size_param != input.named_parameters.end()) {
+			result->morsel_size = UBigIntValue::Get(morsel_size_param->second);
+			if (result->morsel_size == 0) {
+				throw InvalidInputException("Morsel size must be greater than zero");
+			}
+		}
+
+		// Get the filename list
+		const auto mfreader = MultiFileReader::Create(input.table_function);
+		const auto mflist = mfreader->CreateFileList(context, input.inputs[0]);
+
+		// Prepare the reader of each file to get the layout of the points, the output schema is the union of the
+		// dimensions of all files by name. The points are not read here but streamed when the scan is executed.
+
+		unordered_map<string, idx_t> dimension_map;
+
+		for (const auto &file : mflist->GetAllFiles()) {
+			FileData file_data;
+			file_data.file_name = file.path;
+
+			if (!pdal::FileUtils::fileExists(file_data.file_name)) {
+				throw InvalidInputException("File not found: %s", file_data.file_name);
+			}
+
+			// Only the header of the file is read to get the layout, the number of points and their bounds. It is
+			// cached while the file is unchanged.
+			auto metadata_cache = PdalMetadataCache::Get(context);
+			const auto metadata = metadata_cache->GetMetadata(context, file_data.file_name, result->reader_options);
+			file_data.driver = metadata->driver;
+
+			for (const auto &dimension : metadata->dimensions) {
+				const auto &dimension_name = dimension.first;
+				const auto dimension_type = PDAL_Utils::DimensionType(dimension.second);
+				auto entry = dimension_map.find(dimension_name);
+
+				if (entry == dimension_map.end()) {
+					dimension_map.emplace(dimension_name, names.size());
+					names.push_back(dimension_name);
+					return_types.push_back(dimension_type);
+				} else if (return_types[entry->second] != dimension_type) {
+					throw InvalidInputException("Dimension '%s' is %s in file '%s', but %s in previous files",
+					                            dimension_name, dimension_type.ToString(), file_data.file_name,
+					                            return_types[entry->second].ToString());
+				}
+			}
+
+			file_data.streamable = metadata->streamable;
+			file_data.has_point_count = metadata->valid;
+			file_data.point_count = metadata->point_count;
+
+			const bool has_bounds = metadata->valid && metadata->bounds.valid();
+			if (has_bounds) {
+				file_data.bounds.Restrict(0, metadata->bounds.minx, metadata->bounds.maxx);
+				file_data.bounds.Restrict(1, metadata->bounds.miny, metadata->bounds.maxy);
+				file_data.bounds.Restrict(2, metadata->bounds.minz, metadata->bounds.maxz);
+			}
+
+			if (file_data.driver == "readers.las" && metadata->has_las_header) {
+				ReadHeaderScale(*metadata, file_data);
+
+				if (has_bounds) {
+					ReadHeaderStatistics(*metadata, file_data);
+				}
+			}
+
+			// LAS/LAZ files are split into ranges of points read in parallel, unless the user sets the range to read.
+			const auto morsel_size = result->morsel_size;
+			if (file_data.driver == "readers.las" && file_data.streamable && file_data.point_count > morsel_size &&
+			    !result->reader_options.hasOption("start") && !result->reader_options.hasOption("count")) {
+				file_data.morsel_size = morsel_size;
+			}
+			// COPC files are split into XY tiles of the bounds, the reader only loads the octree nodes of each tile.
+			if (file_data.driver == "readers.copc" && file_data.streamable && file_data.point_count > morsel_size &&
+			    file_data.bounds.IsBounded(0) && file_data.bounds.IsBounded(1)) {
+				const auto tile_count = static_cast<double>(file_data.point_count) / static_cast<double>(morsel_size);
+				file_data.tiles_per_axis = static_cast<idx_t>(std::ceil(std::sqrt(tile_count)));
+			}
+
+			// Reading a range or a level of detail of the file changes the number of points returned by the reader.
+			const auto &options = result->reader_options;
+			file_data.exact_point_count =
+			    file_data.has_point_count &&
+			    ((file_data.driver == "readers.las" && !options.hasOption("start") && !options.hasOption("count")) ||
+			     (file_data.driver == "readers.copc" && !options.hasOption("bounds") &&
+			      !options.hasOption("resolution") && result->resolution == 0));
+
+			result->point_count += file_data.point_count;
+			result->files.push_back(std::move(file_data));
+		}
+		result->names = names;
+
+		if (result->coordinates != PDAL_Utils::CoordinateEncoding::DOUBLE) {
+			BindCoordinateTypes(*result, return_types);
+		}
+
+		if (result->filename_column) {
+			if (dimension_map.count("filename")) {
+				throw BinderException("Column 'filename' conflicts with a dimension of the point clouds");
+			}
+			names.emplace_back("filename");
+			return_types.push_back(LogicalType::VARCHAR);
+		}
+
+		// The hive partitions of the first file define the partition columns, their types are detected from the
+		// values of all files.
+		if (auto_hive_partitioning) {
+			hive_partitioning = DetectHivePartitioning(*result, dimension_map);
+		}
+		if (hive_partitioning && !result->files.empty()) {
+			const auto first_partition_column = return_types.size();
+
+			for (const auto &partition : HivePartitioning::Parse(result->files[0].file_name)) {
+				const auto is_filename = result->filename_column && partition.first == "filename";
+
+				if (dimension_map.count(partition.first) || is_filename) {
+					throw BinderException("Hive partition '%s' conflicts with a column of the point clouds",
+					                      partition.first);
+				}
+				result->partition_names.push_back(partition.first);
+				names.push_back(partition.first);
+				return_types.push_back(LogicalType::VARCHAR);
+			}
+			for (auto &file_data : result->files) {
+				auto partitions = HivePartitioning::Parse(file_data.file_name);
+
+				for (const auto &partition_name : result->partition_names) {
+					auto entry = partitions.find(partition_name);
+					file_data.partition_values.push_back(entry == partitions.end() ? Value(LogicalType::VARCHAR)
+					                                                                : Value(entry->second));
+				}
+			}
+			for (idx_t partition_idx = 0; partition_idx < result->partition_names.size(); partition_idx++) {
+				return_types[first_partition_column + partition_idx] =
+				    DetectPartitionType(context, result->files, partition_idx);
+			}
+		}
+
+		if (geometry_column) {
+			if (std::find(names.begin(), names.end(), "geometry") != names.end()) {
+				throw BinderException("Column 'geometry' conflicts with a column of the point clouds");
+			}
+			result->geometry_id = names.size();
+			names.emplace_back("geometry");
+			return_types.push_back(PDAL_Utils::GeometryType());
+		}
+
+		return std::move(result);
 	};
 
 	//------------------------------------------------------------------------------------------------------------------
 	// Init Global
 	//------------------------------------------------------------------------------------------------------------------
 
+	// A range of points or a tile of a file scanned by a single thread.
+	struct Morsel {
+		idx_t file_idx;
+		idx_t range_idx;
+		// Box of the points to read, the pushed down filter clipped to the tile of the morsel.
+		PDAL_Utils::BoundingBox box;
+	};
+
+	// Returns true if no dimension is projected nor filtered (e.g. COUNT(*)), then the number of points of the files
+	// with an exact count in their header is enough to answer the scan.
+	static bool IsCountOnly(const BindData &bind_data, const vector<column_t> &column_ids) {
+		if (bind_data.filter_box.IsBounded()) {
+			return false;
+		}
+		for (const auto &column_id : column_ids) {
+			if (column_id < bind_data.names.size() || column_id == bind_data.geometry_id) {
+				return false;
+			}
+		}
+		return true;
+	}
+
 	struct GlobalState final : GlobalTableFunctionState {
-		pdal::PointId point_idx;
-		explicit GlobalState(ClientContext &context) : point_idx(0) {
+		mutex lock;
+		vector<Morsel> morsels;
+		idx_t next_morsel;
+
+		explicit GlobalState(ClientContext &context) : next_morsel(0) {
+		}
+
+		idx_t MaxThreads() const override {
+			return MaxValue<idx_t>(1, morsels.size());
+		}
+
+		// Get the index of the next morsel to scan, returns false when all morsels are assigned.
+		bool NextMorsel(idx_t &morsel_idx) {
+			lock_guard<mutex> guard(lock);
+
+			if (next_morsel >= morsels.size()) {
+				return false;
+			}
+			morsel_idx = next_morsel++;
+			return true;
 		}
 	};
 
 	static unique_ptr<GlobalTableFunctionState> InitGlobal(ClientContext &context, TableFunctionInitInput &input) {
+		auto &bind_data = input.bind_data->Cast<BindData>();
 		auto result = make_uniq<GlobalState>(context);
+
+		// The files are split into morsels distributed across the threads of the scan, tiles not intersecting the
+		// pushed down filter are skipped.
+		const auto count_only = IsCountOnly(bind_data, input.column_ids);
+
+		for (idx_t file_idx = 0; file_idx < bind_data.files.size(); file_idx++) {
+			const auto &file = bind_data.files[file_idx];
+			const auto morsel_count = file.MorselCount();
+
+			// The points of the file are counted from its header, no need to split it.
+			if (count_only && file.exact_point_count) {
+				result->morsels.push_back({file_idx, 0, bind_data.filter_box});
+				continue;
+			}
+
+			for (idx_t range_idx = 0; range_idx < morsel_count; range_idx++) {
+				auto tile = file.GetTile(range_idx);
+
+				if (!tile.Intersects(bind_data.filter_box)) {
+					continue;
+				}
+				tile.Clip(bind_data.filter_box);
+				result->morsels.push_back({file_idx, range_idx, tile});
+			}
+		}
 		return std::move(result);
 	}
 
@@ -1074,207 +2028,1825 @@ struct PDAL_Pipeline {
 	// Init Local
 	//------------------------------------------------------------------------------------------------------------------
 
-	//------------------------------------------------------------------------------------------------------------------
-	// Execute
-	//------------------------------------------------------------------------------------------------------------------
+	struct LocalState final : LocalTableFunctionState {
+		// Each thread owns its reader, it must outlive the stream and the view created from it.
+		std::unique_ptr<pdal::Stage> reader;
+
+		// Streaming scan, the reader decodes the points in batches on demand.
+		std::unique_ptr<PdalPointStream> stream;
+		pdal::PointId batch_idx;
+
+		// Materialized scan, for readers that do not support stream mode.
+		std::unique_ptr<pdal::PointTable> table;
+		pdal::PointViewPtr view;
+		pdal::PointId point_idx;
+
+		// Projected output columns bound to the dimensions of the point layout.
+		vector<column_t> column_ids;
+		PDAL_Utils::ScanBindings bindings;
+
+		// Count-only scan, the rows are emitted from the number of points of the header without reading them.
+		bool count_only;
+		bool from_header;
+		idx_t remaining_rows;
+
+		// Morsel being scanned by this thread.
+		bool active;
+		idx_t morsel_idx;
+
+		LocalState(const vector<column_t> &column_ids_p, bool count_only_p)
+		    : batch_idx(0), point_idx(0), column_ids(column_ids_p), count_only(count_only_p), from_header(false),
+		      remaining_rows(0), active(false), morsel_idx(0) {
+		}
+
+		// Open a reader for the points of a morsel.
+		void Open(const BindData &bind_data, const Morsel &morsel, idx_t morsel_idx_p) {
+			Close();
+
+			const auto &file = bind_data.files[morsel.file_idx];
+			morsel_idx = morsel_idx_p;
+			active = true;
+
+			if (count_only && file.exact_point_count) {
+				bindings = PDAL_Utils::ScanBindings();
+				for (idx_t col_idx = 0; col_idx < column_ids.size(); col_idx++) {
+					bindings.null_columns.push_back(col_idx);
+				}
+				BindFileColumns(bind_data, file);
+
+				from_header = true;
+				remaining_rows = file.point_count;
+				return;
+			}
+
+			reader = CreateReader(bind_data, file, morsel.range_idx, morsel.box);
+
+			if (file.streamable) {
+				stream = std::make_unique<PdalPointStream>(*reader);
+				bindings = PDAL_Utils::BindDimensions(stream->Layout(), bind_data.names, column_ids, true);
+			} else {
+				table = std::make_unique<pdal::PointTable>();
+				reader->prepare(*table);
+
+				pdal::PointViewSet views = reader->execute(*table);
+				view = *(views.begin());
+				bindings = PDAL_Utils::BindDimensions(view->layout(), bind_data.names, column_ids, true);
+			}
+			auto layout = table ? table->layout() : stream->Layout();
+			PDAL_Utils::BindSpatialFilter(layout, morsel.box, bindings);
+			PDAL_Utils::BindGeometry(layout, column_ids, bind_data.geometry_id, bindings);
+			BindFileColumns(bind_data, file);
+			BindCoordinates(bind_data, file);
+
+			batch_idx = 0;
+			point_idx = 0;
+		}
+
+		// Emit the X/Y/Z coordinates as integers of the scale of the file, the raw values are relative to its offset.
+		void BindCoordinates(const BindData &bind_data, const FileData &file) {
+			if (bind_data.coordinates == PDAL_Utils::CoordinateEncoding::DOUBLE) {
+				return;
+			}
+			for (auto &binding : bindings.dimensions) {
+				const auto axis = PDAL_Utils::CoordinateAxis(bind_data.names[column_ids[binding.column_idx]]);
+
+				if (axis >= 0 && binding.type == pdal::Dimension::Type::Double) {
+					const auto raw = bind_data.coordinates == PDAL_Utils::CoordinateEncoding::RAW;
+					binding.encoding = bind_data.coordinates;
+					binding.scale = file.scale[axis];
+					binding.scale_offset = raw ? file.offset[axis] : 0.0;
+				}
+			}
+		}
+
+		// The file name and the hive partitions are constant for all points of a file.
+		void BindFileColumns(const BindData &bind_data, const FileData &file) {
+			const auto first_file_column = bind_data.names.size();
+
+			for (idx_t col_idx = 0; col_idx < column_ids.size(); col_idx++) {
+				if (column_ids[col_idx] < first_file_column) {
+					continue;
+				}
+				auto file_column = column_ids[col_idx] - first_file_column;
+
+				if (bind_data.filename_column) {
+					if (file_column == 0) {
+						bindings.SetConstant(col_idx, Value(file.file_name));
+						continue;
+					}
+					file_column--;
+				}
+				if (file_column < file.partition_values.size()) {
+					bindings.SetConstant(col_idx, file.partition_values[file_column]);
+				}
+			}
+		}
+
+		// Release the reader of the current morsel.
+		void Close() {
+			stream.reset();
+			view.reset();
+			table.reset();
+			reader.reset();
+			from_header = false;
+			remaining_rows = 0;
+			active = false;
+		}
+	};
+
+	static unique_ptr<LocalTableFunctionState> InitLocal(ExecutionContext &context, TableFunctionInitInput &input,
+	                                                     GlobalTableFunctionState *gstate_p) {
+		auto &bind_data = input.bind_data->Cast<BindData>();
+		return make_uniq<LocalState>(input.column_ids, IsCountOnly(bind_data, input.column_ids));
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Execute
+	//------------------------------------------------------------------------------------------------------------------
+
+	static void Execute(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
+		auto &bind_data = input.bind_data->Cast<BindData>();
+		auto &gstate = input.global_state->Cast<GlobalState>();
+		auto &lstate = input.local_state->Cast<LocalState>();
+
+		// Load the next subset of points into the output, moving to the next morsel when the current one is done.
+		idx_t output_size = 0;
+
+		while (true) {
+			if (!lstate.active) {
+				idx_t morsel_idx;
+				if (!gstate.NextMorsel(morsel_idx)) {
+					break;
+				}
+				lstate.Open(bind_data, gstate.morsels[morsel_idx], morsel_idx);
+			}
+
+			if (lstate.from_header) {
+				output_size = MinValue<idx_t>(STANDARD_VECTOR_SIZE, lstate.remaining_rows);
+				lstate.remaining_rows -= output_size;
+				PDAL_Utils::SetConstantColumns(lstate.bindings, output);
+			} else if (lstate.stream) {
+				output_size = PDAL_Utils::WriteStreamChunk(*lstate.stream, lstate.batch_idx, lstate.bindings, output);
+			} else {
+				output_size = PDAL_Utils::WriteViewChunk(*lstate.view, lstate.point_idx, lstate.bindings, output);
+			}
+			if (output_size > 0) {
+				break;
+			}
+			lstate.Close();
+		}
+
+		// Set the cardinality of the output
+		output.SetCardinality(output_size);
+	};
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Partition Data
+	//------------------------------------------------------------------------------------------------------------------
+
+	// The morsel of each chunk is used as batch index, so the insertion order is kept when scanning in parallel.
+	static OperatorPartitionData GetPartitionData(ClientContext &context, TableFunctionGetPartitionInput &input) {
+		if (input.partition_info.RequiresPartitionColumns()) {
+			throw InternalException("PDAL_Read::GetPartitionData: partition columns not supported");
+		}
+		auto &lstate = input.local_state->Cast<LocalState>();
+		return OperatorPartitionData(lstate.morsel_idx);
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Cardinality
+	//------------------------------------------------------------------------------------------------------------------
+
+	static unique_ptr<NodeStatistics> Cardinality(ClientContext &context, const FunctionData *data) {
+
+		auto &bind_data = data->Cast<BindData>();
+		auto result = make_uniq<NodeStatistics>();
+
+		bool has_point_count = true;
+		bool exact_point_count = true;
+		for (const auto &file : bind_data.files) {
+			has_point_count = has_point_count && file.has_point_count;
+			exact_point_count = exact_point_count && file.exact_point_count;
+		}
+
+		// This is the total number of points of all files, from their headers. It is only an upper bound when every
+		// reader returns exactly the points of the header, and it is not reported when a file has no summary (e.g.
+		// text files), where the count is zero.
+		if (has_point_count) {
+			result->has_estimated_cardinality = true;
+			result->estimated_cardinality = bind_data.point_count;
+		}
+		if (exact_point_count) {
+			result->has_max_cardinality = true;
+			result->max_cardinality = bind_data.point_count;
+		}
+		return result;
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Statistics
+	//------------------------------------------------------------------------------------------------------------------
+
+	// Min/max of X, Y, Z and ReturnNumber, available when all files of the scan provide them in their headers.
+	static unique_ptr<BaseStatistics> Statistics(ClientContext &context, const FunctionData *data,
+	                                             column_t column_index) {
+
+		auto &bind_data = data->Cast<BindData>();
+
+		if (column_index >= bind_data.names.size() || bind_data.files.empty()) {
+			return nullptr;
+		}
+		const auto &name = bind_data.names[column_index];
+		const auto axis = PDAL_Utils::CoordinateAxis(name);
+
+		if (axis < 0 && name != "ReturnNumber") {
+			return nullptr;
+		}
+		if (axis >= 0 && bind_data.coordinates != PDAL_Utils::CoordinateEncoding::DOUBLE) {
+			return nullptr;
+		}
+
+		double min_value = std::numeric_limits<double>::infinity();
+		double max_value = -std::numeric_limits<double>::infinity();
+		uint8_t min_return_number = std::numeric_limits<uint8_t>::max();
+		uint8_t max_return_number = 0;
+
+		for (const auto &file : bind_data.files) {
+			if (!file.has_statistics || (axis < 0 && file.min_return_number == 0)) {
+				return nullptr;
+			}
+			if (axis >= 0) {
+				min_value = MinValue(min_value, file.statistics_bounds.lower[axis]);
+				max_value = MaxValue(max_value, file.statistics_bounds.upper[axis]);
+			} else {
+				min_return_number = MinValue(min_return_number, file.min_return_number);
+				max_return_number = MaxValue(max_return_number, file.max_return_number);
+			}
+		}
+
+		if (axis >= 0) {
+			auto stats = NumericStats::CreateEmpty(LogicalType::DOUBLE);
+			NumericStats::SetMin(stats, Value::DOUBLE(min_value));
+			NumericStats::SetMax(stats, Value::DOUBLE(max_value));
+			stats.Set(StatsInfo::CANNOT_HAVE_NULL_VALUES);
+			return stats.ToUnique();
+		}
+		auto stats = NumericStats::CreateEmpty(LogicalType::UTINYINT);
+		NumericStats::SetMin(stats, Value::UTINYINT(min_return_number));
+		NumericStats::SetMax(stats, Value::UTINYINT(max_return_number));
+		stats.Set(StatsInfo::CANNOT_HAVE_NULL_VALUES);
+		return stats.ToUnique();
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Filter Pushdown
+	//------------------------------------------------------------------------------------------------------------------
+
+	static void PushdownComplexFilter(ClientContext &context, LogicalGet &get, FunctionData *bind_data_p,
+	                                  vector<unique_ptr<Expression>> &filters) {
+
+		auto &bind_data = bind_data_p->Cast<BindData>();
+
+		// Filters are kept in the plan, the box is just used to skip points before they reach DuckDB.
+		PDAL_Utils::BoundingBox box;
+		for (const auto &filter : filters) {
+			PDAL_Utils::ExtractBoundingBox(*filter, get, bind_data.names, box);
+		}
+		if (!box.IsBounded()) {
+			return;
+		}
+
+		// Raw coordinates are filtered in the units of the file, the box is converted to the decoded coordinates the
+		// same way the readers do it. All files share the same scale and offset in this mode.
+		if (bind_data.coordinates == PDAL_Utils::CoordinateEncoding::RAW && !bind_data.files.empty()) {
+			const auto &file = bind_data.files[0];
+
+			for (idx_t axis = 0; axis < 3; axis++) {
+				box.lower[axis] = box.lower[axis] * file.scale[axis] + file.offset[axis];
+				box.upper[axis] = box.upper[axis] * file.scale[axis] + file.offset[axis];
+			}
+		}
+
+		// Raw and decimal coordinates are the decoded doubles rounded to the scale, the box is widened by half a unit
+		// so the points rounded onto its sides are kept for the filters of DuckDB. All files share the same scale.
+		if (bind_data.coordinates != PDAL_Utils::CoordinateEncoding::DOUBLE && !bind_data.files.empty()) {
+			const auto &file = bind_data.files[0];
+
+			for (idx_t axis = 0; axis < 3; axis++) {
+				box.lower[axis] -= file.scale[axis] / 2;
+				box.upper[axis] += file.scale[axis] / 2;
+			}
+		}
+		bind_data.filter_box.Clip(box);
+
+		// Drop the files whose header bounds do not intersect the box, they are never opened by the scan. The bounds
+		// are widened by one scale unit, as writers may round them.
+		auto &files = bind_data.files;
+		files.erase(std::remove_if(files.begin(), files.end(),
+		                           [&](const FileData &file) {
+			                           return !bind_data.filter_box.Intersects(file.PruningBounds());
+		                           }),
+		            files.end());
+
+		bind_data.point_count = 0;
+		for (const auto &file : files) {
+			bind_data.point_count += file.point_count;
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Replacement Scan
+	//------------------------------------------------------------------------------------------------------------------
+
+	static unique_ptr<TableRef> ReplacementScan(ClientContext &, ReplacementScanInput &input,
+	                                            optional_ptr<ReplacementScanData>) {
+		auto &table_name = input.table_name;
+		auto lower_name = StringUtil::Lower(table_name);
+
+		// Check if the file name ends with some common LiDAR file extensions
+		if (StringUtil::EndsWith(lower_name, ".las") || StringUtil::EndsWith(lower_name, ".laz")) {
+
+			auto table_function = make_uniq<TableFunctionRef>();
+			vector<unique_ptr<ParsedExpression>> children;
+			children.push_back(make_uniq<ConstantExpression>(Value(table_name)));
+			table_function->function = make_uniq<FunctionExpression>("PDAL_Read", std::move(children));
+			return std::move(table_function);
+		}
+		// else not something we can replace
+		return nullptr;
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Documentation
+	//------------------------------------------------------------------------------------------------------------------
+
+	static constexpr auto DESCRIPTION = R"(
+		Read and import a variety of point cloud data file formats using the PDAL library, from one or more files.
+	)";
+
+	static constexpr auto EXAMPLE = R"(
+		SELECT * FROM PDAL_Read('path/to/your/filename.las') LIMIT 10;
+
+		┌───────────┬───────────┬────────┐
+		│     X     │     Y     │   Z    │
+		│   double  │   double  │ double │
+		├───────────┼───────────┼────────┤
+		│ 637177.98 │ 849393.95 │ 411.19 │
+		│ 637177.30 │ 849396.95 │ 411.25 │
+		│ 637176.34 │ 849400.84 │ 411.01 │
+		│ 637175.45 │ 849404.62 │ 410.99 │
+		│ 637174.33 │ 849407.37 │ 411.38 │
+		└───────────┴───────────┴────────┘
+
+		SELECT * FROM PDAL_Read('path/to/your/filename.las', options => MAP {'start': 10});
+
+		Optional Options parameter can be used to pass reader-specific options as key-value pairs.
+		For example, for the LAS/LAZ reader, the options are documented at https://pdal.io/en/stable/stages/readers.las.html#options
+
+		SELECT filename, COUNT(*) FROM PDAL_Read('path/to/tiles/**/*.laz', filename => true) GROUP BY filename;
+
+		A glob pattern or a list of files can be read at once, the columns are the union of the dimensions of all files.
+		Optional filename and hive_partitioning parameters add the path and the hive partitions of each file as columns.
+		The hive partitions are detected when all files have the same ones, unless hive_partitioning is set.
+
+		SELECT COUNT(*) FROM PDAL_Read('path/to/your/filename.copc.laz', resolution => 10.0);
+
+		Optional resolution parameter limits the depth of the octree read from COPC and EPT sources, for fast previews.
+
+		SELECT X, Y, Z FROM PDAL_Read('path/to/your/filename.laz', coordinates => 'raw');
+
+		Optional coordinates parameter sets how X/Y/Z of LAS/LAZ files are returned: 'double' (default), 'raw' for the
+		scaled integers stored in the file, or 'decimal' with the digits of the scale. Use PDAL_Info to get the scale
+		and offset of each file.
+
+		SELECT geometry FROM PDAL_Read('path/to/your/filename.laz', geometry => true);
+
+		Optional geometry parameter adds a geometry column with the points as WKB POINT Z, ready for DuckDB spatial.
+		The geometry has the decoded double coordinates, whatever the coordinates parameter.
+
+		SELECT COUNT(*) FROM PDAL_Read('path/to/your/filename.laz', morsel_size => 500000);
+
+		Optional morsel_size parameter sets the number of points (1000000 by default, greater than zero) of the ranges
+		in which large LAS/LAZ and COPC files are split to be scanned in parallel. Use a multiple of the LAZ chunk size
+		(50000 points).
+	)";
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Register
+	//------------------------------------------------------------------------------------------------------------------
+
+	static void Register(ExtensionLoader &loader) {
+
+		InsertionOrderPreservingMap<string> tags;
+		tags.insert("ext", "pdal");
+		tags.insert("category", "table");
+
+		TableFunctionSet func_set("PDAL_Read");
+
+		// A single file or glob pattern, or a list of them
+		for (const auto &input_type : {LogicalType::VARCHAR, LogicalType::LIST(LogicalType::VARCHAR)}) {
+			TableFunction func("PDAL_Read", {input_type}, Execute, Bind, InitGlobal, InitLocal);
+
+			func.cardinality = Cardinality;
+			func.statistics = Statistics;
+			func.get_partition_data = GetPartitionData;
+			func.projection_pushdown = true;
+			func.pushdown_complex_filter = PushdownComplexFilter;
+			func.named_parameters["options"] = LogicalType::MAP(LogicalType::VARCHAR, LogicalType::VARCHAR);
+			func.named_parameters["filename"] = LogicalType::BOOLEAN;
+			func.named_parameters["hive_partitioning"] = LogicalType::BOOLEAN;
+			func.named_parameters["resolution"] = LogicalType::DOUBLE;
+			func.named_parameters["coordinates"] = LogicalType::VARCHAR;
+			func.named_parameters["geometry"] = LogicalType::BOOLEAN;
+			func.named_parameters["morsel_size"] = LogicalType::UBIGINT;
+
+			func_set.AddFunction(func);
+		}
+
+		RegisterFunction<TableFunctionSet>(loader, func_set, CatalogType::TABLE_FUNCTION_ENTRY, DESCRIPTION, EXAMPLE,
+		                                   tags);
+
+		// Replacement scan
+		auto &db = loader.GetDatabaseInstance();
+		auto &config = DBConfig::GetConfig(db);
+		config.replacement_scans.emplace_back(ReplacementScan);
+	}
+};
+
+//======================================================================================================================
+// PDAL_Pipeline
+//======================================================================================================================
+
+struct PDAL_Pipeline {
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Bind
+	//------------------------------------------------------------------------------------------------------------------
+
+	struct FileData {
+		string file_name;
+		std::string driver;
+		// Bounds of the points from the header of the file, unbounded if the reader does not provide them.
+		PDAL_Utils::BoundingBox bounds;
+		// Number of tiles along X and Y when the file is split in tiles.
+		idx_t tiles[2] = {1, 1};
+
+		idx_t TileCount() const {
+			return tiles[0] * tiles[1];
+		}
+
+		// Get the XY core tile of a file split in tiles of the given size. The tiles are half-open and the outer ones
+		// unbounded, so each point belongs to exactly one tile.
+		PDAL_Utils::BoundingBox GetTile(idx_t tile_idx, double tile_size) const {
+			PDAL_Utils::BoundingBox tile;
+			const idx_t tile_xy[2] = {tile_idx % tiles[0], tile_idx / tiles[0]};
+
+			for (idx_t axis = 0; axis < 2; axis++) {
+				if (tile_xy[axis] > 0) {
+					tile.lower[axis] = bounds.lower[axis] + tile_size * static_cast<double>(tile_xy[axis]);
+				}
+				if (tile_xy[axis] + 1 < tiles[axis]) {
+					const double upper = bounds.lower[axis] + tile_size * static_cast<double>(tile_xy[axis] + 1);
+					tile.upper[axis] = std::nextafter(upper, -std::numeric_limits<double>::infinity());
+				}
+			}
+			return tile;
+		}
+	};
+
+	struct BindData final : TableFunctionData {
+		vector<FileData> files;
+		// Parsed pipeline definition, shared by the queries running the same pipeline.
+		std::shared_ptr<const PdalPipelineTemplate> pipeline_template;
+		pdal::Options reader_options;
+		vector<string> names;
+		bool filename_column = false;
+		// Size of the XY tiles the files are split in, and the width of the halo read around each tile. Zero if the
+		// files are not split.
+		double tile_size = 0;
+		double buffer = 0;
+		// Number of points of the input files, unknown when a reader can't preview them.
+		bool has_point_count = true;
+		uint64_t point_count = 0;
+		// Column id of the geometry column, the last of the output.
+		column_t geometry_id = DConstants::INVALID_INDEX;
+	};
+
+	// Dimension flagging the points of the core tile, set before the pipeline runs since its stages may move them.
+	static constexpr const char *CORE_TILE_DIMENSION = "DuckDBCoreTile";
+
+	// Format the condition of a PDAL expression testing that the points are in the XY core tile.
+	static std::string CoreTileCondition(const PDAL_Utils::BoundingBox &tile) {
+		const char *dims[2] = {"X", "Y"};
+		std::ostringstream ss;
+		ss.precision(17);
+
+		for (idx_t axis = 0; axis < 2; axis++) {
+			if (std::isfinite(tile.lower[axis])) {
+				ss << (ss.tellp() > 0 ? " && " : "") << dims[axis] << " >= " << tile.lower[axis];
+			}
+			if (std::isfinite(tile.upper[axis])) {
+				ss << (ss.tellp() > 0 ? " && " : "") << dims[axis] << " <= " << tile.upper[axis];
+			}
+		}
+		return ss.str();
+	}
+
+	// Maximum number of tiles a file is split in, when its reader only loads the points of each tile (COPC/EPT).
+	static constexpr idx_t MAX_TILE_COUNT = 100000;
+	// Maximum number of tiles a file is split in when each tile reads the whole file again.
+	static constexpr idx_t MAX_FULL_READ_TILE_COUNT = 16;
+
+	// Returns true if the reader of a file only loads the points of the bounds of a tile.
+	static bool ReadsTileBounds(const BindData &bind_data, const FileData &file_data) {
+		return PDAL_Read::IsOctreeDriver(file_data.driver) && !bind_data.reader_options.hasOption("bounds");
+	}
+
+	// Create the PDAL Pipeline Manager from the template of the pipeline definition, reading the input file. Only
+	// the points of the box are read, if bounded. The points read in the core tile, if bounded, are flagged in the
+	// CORE_TILE_DIMENSION dimension.
+	static std::unique_ptr<pdal::PipelineManager>
+	CreatePipeline(const BindData &bind_data, const FileData &file_data,
+	               const PDAL_Utils::BoundingBox &box = PDAL_Utils::BoundingBox(),
+	               const PDAL_Utils::BoundingBox &tile = PDAL_Utils::BoundingBox()) {
+
+		// The template has a single root stage
+		std::unique_ptr<pdal::PipelineManager> pipeline = bind_data.pipeline_template->Instantiate();
+		std::vector<pdal::Stage *> roots = pipeline->roots();
+
+		// Create the PDAL reader based on file extension and set reader options.
+
+		pdal::Options reader_options = bind_data.reader_options;
+		reader_options.add("filename", file_data.file_name);
+
+		// Readers of indexed formats only load the nodes intersecting the box, otherwise the box is cropped.
+		const bool octree = ReadsTileBounds(bind_data, file_data);
+		if (box.IsBounded() && octree) {
+			reader_options.add("bounds", box.ToBoundsOption());
+		}
+
+		pdal::Stage *input = &pipeline->makeReader(file_data.file_name, file_data.driver, reader_options);
+
+		if (box.IsBounded() && !octree) {
+			pdal::Options crop_options;
+			crop_options.add("bounds", box.ToBoundsOption());
+			input = &pipeline->makeFilter("filters.crop", *input, crop_options);
+		}
+		if (tile.IsBounded()) {
+			pdal::Options ferry_options;
+			ferry_options.add("dimensions", std::string("=>") + CORE_TILE_DIMENSION);
+			input = &pipeline->makeFilter("filters.ferry", *input, ferry_options);
+
+			pdal::Options assign_options;
+			assign_options.add("value", std::string(CORE_TILE_DIMENSION) + " = 1 WHERE " + CoreTileCondition(tile));
+			input = &pipeline->makeFilter("filters.assign", *input, assign_options);
+		}
+		roots[0]->setInput(*input);
+		return pipeline;
+	}
+
+	static unique_ptr<FunctionData> Bind(ClientContext &context, TableFunctionBindInput &input,
+	                                     vector<LogicalType> &return_types, vector<string> &names) {
+
+		auto the_pipeline = StringValue::Get(input.inputs[1]);
+
+		auto result = make_uniq<BindData>();
+		result->pipeline_template = PdalPipelineTemplate::Get(context, the_pipeline);
+
+		auto options_param = input.named_parameters.find("options");
+		if (options_param != input.named_parameters.end()) {
+			const std::vector<duckdb::Value> &children = MapValue::GetChildren(options_param->second);
+			PDAL_Utils::ParseOptions(children, result->reader_options);
+		}
+		auto filename_param = input.named_parameters.find("filename");
+		if (filename_param != input.named_parameters.end()) {
+			result->filename_column = BooleanValue::Get(filename_param->second);
+		}
+		auto tile_size_param = input.named_parameters.find("tile_size");
+		if (tile_size_param != input.named_parameters.end()) {
+			result->tile_size = DoubleValue::Get(tile_size_param->second);
+			if (!std::isfinite(result->tile_size) || result->tile_size <= 0) {
+				throw BinderException("Tile size must be a positive number");
+			}
+		}
+		auto buffer_param = input.named_parameters.find("buffer");
+		if (buffer_param != input.named_parameters.end()) {
+			result->buffer = DoubleValue::Get(buffer_param->second);
+			if (!std::isfinite(result->buffer) || result->buffer < 0) {
+				throw BinderException("Buffer must be a positive number");
+			}
+			if (result->tile_size == 0) {
+				throw InvalidInputException("Buffer requires the tile_size parameter");
+			}
+		}
+
+		// Get the filename list
+		const auto mfreader = MultiFileReader::Create(input.table_function);
+		const auto mflist = mfreader->CreateFileList(context, input.inputs[0]);
+
+		// The pipeline of each file is only prepared here to get the layout of the points, the output schema is the
+		// union of the dimensions of all files by name. It runs when the scan starts, either in stream mode or
+		// filling a point table whose memory is released as the views are consumed.
+
+		unordered_map<string, idx_t> dimension_map;
+
+		for (const auto &file : mflist->GetAllFiles()) {
+			FileData file_data;
+			file_data.file_name = file.path;
+
+			if (!pdal::FileUtils::fileExists(file_data.file_name)) {
+				throw InvalidInputException("File not found: %s", file_data.file_name);
+			}
+			file_data.driver = pdal::StageFactory::inferReaderDriver(file_data.file_name);
+			if (file_data.driver.length() == 0) {
+				throw InvalidInputException("File format not supported: %s", file_data.file_name);
+			}
+
+			auto pipeline = CreatePipeline(*result, file_data);
+			pipeline->prepare();
+
+			vector<LogicalType> file_types;
+			vector<string> file_names;
+			PDAL_Utils::ExtractLayout(pipeline->pointTable().layout(), file_types, file_names);
+
+			for (idx_t i = 0; i < file_names.size(); i++) {
+				auto entry = dimension_map.find(file_names[i]);
+
+				if (entry == dimension_map.end()) {
+					dimension_map.emplace(file_names[i], names.size());
+					names.push_back(file_names[i]);
+					return_types.push_back(file_types[i]);
+				} else if (return_types[entry->second] != file_types[i]) {
+					throw InvalidInputException("Dimension '%s' is %s in file '%s', but %s in previous files",
+					                            file_names[i], file_types[i].ToString(), file_data.file_name,
+					                            return_types[entry->second].ToString());
+				}
+			}
+
+			// Only the header of the file is read to get the number of points and their bounds.
+			const pdal::QuickInfo info = pipeline->roots()[0]->preview();
+			result->has_point_count = result->has_point_count && info.valid();
+			result->point_count += info.m_pointCount;
+
+			if (info.valid() && info.m_bounds.valid()) {
+				file_data.bounds.Restrict(0, info.m_bounds.minx, info.m_bounds.maxx);
+				file_data.bounds.Restrict(1, info.m_bounds.miny, info.m_bounds.maxy);
+				file_data.bounds.Restrict(2, info.m_bounds.minz, info.m_bounds.maxz);
+			}
+			// Files without bounds are not split, they are a single tile.
+			// Each tile runs the reader and the pipeline again, the number of tiles of a file is limited. Readers
+			// of other formats than COPC/EPT read the whole file for each tile, so their tiles are limited further.
+			if (result->tile_size > 0 && file_data.bounds.IsBounded(0) && file_data.bounds.IsBounded(1)) {
+				double tile_counts[2];
+				for (idx_t axis = 0; axis < 2; axis++) {
+					const double extent = file_data.bounds.upper[axis] - file_data.bounds.lower[axis];
+					tile_counts[axis] = MaxValue<double>(1, std::ceil(extent / result->tile_size));
+				}
+				if (!ReadsTileBounds(*result, file_data) &&
+				    tile_counts[0] * tile_counts[1] > static_cast<double>(MAX_FULL_READ_TILE_COUNT)) {
+					throw BinderException("Tile size %f splits file '%s' into more than %d tiles, each tile reads the "
+					                      "whole file with the '%s' reader",
+					                      result->tile_size, file_data.file_name, MAX_FULL_READ_TILE_COUNT,
+					                      file_data.driver);
+				}
+				if (tile_counts[0] * tile_counts[1] > static_cast<double>(MAX_TILE_COUNT)) {
+					throw BinderException("Tile size %f splits file '%s' into more than %d tiles", result->tile_size,
+					                      file_data.file_name, MAX_TILE_COUNT);
+				}
+				for (idx_t axis = 0; axis < 2; axis++) {
+					file_data.tiles[axis] = static_cast<idx_t>(tile_counts[axis]);
+				}
+			}
+
+			result->files.push_back(std::move(file_data));
+		}
+		result->names = names;
+
+		// The views created by the pipeline (e.g. by filters.splitter or filters.chipper) are told apart by their id.
+		if (dimension_map.count("view_id")) {
+			throw BinderException("Column 'view_id' conflicts with a dimension of the point cloud");
+		}
+		names.emplace_back("view_id");
+		return_types.push_back(LogicalType::INTEGER);
+
+		if (result->filename_column) {
+			if (dimension_map.count("filename")) {
+				throw BinderException("Column 'filename' conflicts with a dimension of the point cloud");
+			}
+			names.emplace_back("filename");
+			return_types.push_back(LogicalType::VARCHAR);
+		}
+
+		auto geometry_param = input.named_parameters.find("geometry");
+		if (geometry_param != input.named_parameters.end() && BooleanValue::Get(geometry_param->second)) {
+			if (std::find(names.begin(), names.end(), "geometry") != names.end()) {
+				throw BinderException("Column 'geometry' conflicts with a dimension of the point cloud");
+			}
+			result->geometry_id = names.size();
+			names.emplace_back("geometry");
+			return_types.push_back(PDAL_Utils::GeometryType());
+		}
+
+		return std::move(result);
+	};
+
+	// Bind the projected columns to the layout of the points of a file, the view id and file name are constant.
+	// Only the points flagged in the core tile are emitted, the points of its halo belong to the neighbour tiles.
+	// The flag is set on the input coordinates, so the points moved by the pipeline stay in their tile.
+	static PDAL_Utils::ScanBindings BindColumns(const BindData &bind_data, pdal::PointLayoutPtr layout,
+	                                            const vector<column_t> &column_ids, const FileData &file_data,
+	                                            int view_id,
+	                                            const PDAL_Utils::BoundingBox &tile = PDAL_Utils::BoundingBox()) {
+
+		auto bindings = PDAL_Utils::BindDimensions(layout, bind_data.names, column_ids, true);
+		PDAL_Utils::BindGeometry(layout, column_ids, bind_data.geometry_id, bindings);
+		if (tile.IsBounded()) {
+			const pdal::Dimension::Id flag_id = layout->findDim(CORE_TILE_DIMENSION);
+
+			if (flag_id == pdal::Dimension::Id::Unknown || layout->dimType(flag_id) != pdal::Dimension::Type::Double) {
+				throw InvalidInputException("The pipeline removed the '%s' dimension required by tile_size",
+				                            CORE_TILE_DIMENSION);
+			}
+			bindings.filter_flag = true;
+			bindings.flag_offset = static_cast<std::size_t>(layout->dimDetail(flag_id)->offset());
+		}
+
+		for (idx_t col_idx = 0; col_idx < column_ids.size(); col_idx++) {
+			if (column_ids[col_idx] == bind_data.names.size()) {
+				bindings.SetConstant(col_idx, Value::INTEGER(view_id));
+			} else if (bind_data.filename_column && column_ids[col_idx] == bind_data.names.size() + 1) {
+				bindings.SetConstant(col_idx, Value(file_data.file_name));
+			}
+		}
+		return bindings;
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Pipeline Run
+	//------------------------------------------------------------------------------------------------------------------
+
+	// A run of the pipeline over one input file or one tile of it, in stream mode or executed into a point table
+	// whose blocks are freed once all the points of the views referencing them have been copied to the output.
+	struct PipelineRun {
+		// The pipeline must outlive the point table and the stream of its last stage, the table must outlive the
+		// views. Members are destroyed in reverse order.
+		std::unique_ptr<pdal::PipelineManager> pipeline;
+		std::unique_ptr<PdalReleasablePointTable> table;
+		vector<pdal::PointViewPtr> views;
+		std::unique_ptr<PdalPointStream> stream;
+
+		~PipelineRun() {
+			Reset();
+		}
+
+		void Start(const BindData &bind_data, const FileData &file_data,
+		           const PDAL_Utils::BoundingBox &box = PDAL_Utils::BoundingBox(),
+		           const PDAL_Utils::BoundingBox &tile = PDAL_Utils::BoundingBox()) {
+			pipeline = CreatePipeline(bind_data, file_data, box, tile);
+
+			if (pipeline->pipelineStreamable()) {
+				stream = std::make_unique<PdalPointStream>(*pipeline->getStage());
+				return;
+			}
+			table = std::make_unique<PdalReleasablePointTable>();
+
+			pdal::Stage *leaf = pipeline->getStage();
+			leaf->prepare(*table);
+
+			for (const auto &view : leaf->execute(*table)) {
+				table->Retain(*view);
+				views.push_back(view);
+			}
+			table->ReleaseUnreferenced();
+		}
+
+		void Reset() {
+			stream.reset();
+			views.clear();
+			table.reset();
+			pipeline.reset();
+		}
+	};
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Init Global
+	//------------------------------------------------------------------------------------------------------------------
+
+	// A file, or a tile of a file split in tiles, whose pipeline is run and scanned by a single thread.
+	struct Morsel {
+		idx_t file_idx;
+		idx_t tile_idx;
+	};
+
+	struct GlobalState final : GlobalTableFunctionState {
+		mutex lock;
+
+		// A single input file not split in tiles runs here, its views are scanned in parallel and its stream by a
+		// single thread.
+		PipelineRun run;
+		idx_t next_view;
+		pdal::PointId batch_idx;
+		PDAL_Utils::ScanBindings bindings;
+
+		// Otherwise the morsels are run by the threads.
+		vector<Morsel> morsels;
+		idx_t next_morsel;
+		idx_t max_threads;
+
+		explicit GlobalState(ClientContext &context) : next_view(0), batch_idx(0), next_morsel(0), max_threads(1) {
+		}
+
+		idx_t MaxThreads() const override {
+			return max_threads;
+		}
+
+		// Get the next view of the shared run to scan, returns false when all views are assigned.
+		bool NextView(idx_t &view_idx, pdal::PointViewPtr &view) {
+			lock_guard<mutex> guard(lock);
+
+			if (next_view >= run.views.size()) {
+				return false;
+			}
+			view_idx = next_view++;
+			view = std::move(run.views[view_idx]);
+			return true;
+		}
+
+		// Get the next morsel to run, returns false when all morsels are assigned.
+		bool NextMorsel(idx_t &morsel_idx) {
+			lock_guard<mutex> guard(lock);
+
+			if (next_morsel >= morsels.size()) {
+				return false;
+			}
+			morsel_idx = next_morsel++;
+			return true;
+		}
+	};
+
+	static unique_ptr<GlobalTableFunctionState> InitGlobal(ClientContext &context, TableFunctionInitInput &input) {
+		auto &bind_data = input.bind_data->Cast<BindData>();
+		auto result = make_uniq<GlobalState>(context);
+
+		if (bind_data.files.size() != 1 || bind_data.tile_size > 0) {
+			for (idx_t file_idx = 0; file_idx < bind_data.files.size(); file_idx++) {
+				for (idx_t tile_idx = 0; tile_idx < bind_data.files[file_idx].TileCount(); tile_idx++) {
+					result->morsels.push_back({file_idx, tile_idx});
+				}
+			}
+			result->max_threads = MaxValue<idx_t>(1, result->morsels.size());
+			return std::move(result);
+		}
+
+		// The pipeline runs from scratch, the ones of the bind data were only prepared. PDAL executes the stages of a
+		// non-streamable pipeline on this thread, the threads only scan the resulting views in parallel; only tiles
+		// run the pipeline of a single file in parallel.
+		const auto &file_data = bind_data.files[0];
+		result->run.Start(bind_data, file_data);
+
+		if (result->run.stream) {
+			// There are no views in stream mode
+			result->bindings = BindColumns(bind_data, result->run.stream->Layout(), input.column_ids, file_data, 0);
+		} else {
+			result->max_threads = MaxValue<idx_t>(1, result->run.views.size());
+		}
+		return std::move(result);
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Init Local
+	//------------------------------------------------------------------------------------------------------------------
+
+	struct LocalState final : LocalTableFunctionState {
+		// Run of the morsel assigned to this thread, when there are several input files or tiles.
+		PipelineRun run;
+		idx_t file_idx;
+		PDAL_Utils::BoundingBox tile;
+		idx_t next_view;
+		pdal::PointId batch_idx;
+
+		pdal::PointViewPtr view;
+		pdal::PointId point_idx;
+		// Batch index of the chunks, the view of the single input file or the morsel otherwise.
+		idx_t batch_index;
+
+		vector<column_t> column_ids;
+		PDAL_Utils::ScanBindings bindings;
+
+		explicit LocalState(const vector<column_t> &column_ids_p)
+		    : file_idx(0), next_view(0), batch_idx(0), point_idx(0), batch_index(0), column_ids(column_ids_p) {
+		}
+
+		// Start scanning a view, the local state holds the last reference to it. The views are numbered by their
+		// position in the result of the run, the ids of PDAL come from a process-wide counter.
+		void Open(const BindData &bind_data, pdal::PointViewPtr view_p, idx_t view_idx) {
+			view = std::move(view_p);
+			point_idx = 0;
+			bindings = BindColumns(bind_data, view->layout(), column_ids, bind_data.files[file_idx],
+			                       static_cast<int>(view_idx), tile);
+		}
+
+		// Run the pipeline of a morsel, reading the tile with its halo.
+		void Start(const BindData &bind_data, const Morsel &morsel) {
+			const auto &file_data = bind_data.files[morsel.file_idx];
+			file_idx = morsel.file_idx;
+			tile = bind_data.tile_size > 0 ? file_data.GetTile(morsel.tile_idx, bind_data.tile_size)
+			                               : PDAL_Utils::BoundingBox();
+
+			PDAL_Utils::BoundingBox box = tile;
+			for (idx_t axis = 0; axis < 2; axis++) {
+				box.lower[axis] -= bind_data.buffer;
+				box.upper[axis] += bind_data.buffer;
+			}
+			run.Start(bind_data, file_data, box, tile);
+			next_view = 0;
+		}
+
+		// Move to the next view of the shared run, or to the next view or morsel of the run of this thread. Returns
+		// false when there is nothing left to scan.
+		bool Next(const BindData &bind_data, GlobalState &gstate) {
+			view.reset();
+
+			if (gstate.run.pipeline) {
+				pdal::PointViewPtr next;
+				if (!gstate.NextView(batch_index, next)) {
+					return false;
+				}
+				Open(bind_data, std::move(next), batch_index);
+				return true;
+			}
+
+			while (next_view >= run.views.size()) {
+				run.Reset();
+
+				if (!gstate.NextMorsel(batch_index)) {
+					return false;
+				}
+				Start(bind_data, gstate.morsels[batch_index]);
+
+				if (run.stream) {
+					batch_idx = 0;
+					bindings =
+					    BindColumns(bind_data, run.stream->Layout(), column_ids, bind_data.files[file_idx], 0, tile);
+					return true;
+				}
+			}
+			const idx_t view_idx = next_view++;
+			Open(bind_data, std::move(run.views[view_idx]), view_idx);
+			return true;
+		}
+	};
+
+	static unique_ptr<LocalTableFunctionState> InitLocal(ExecutionContext &context, TableFunctionInitInput &input,
+	                                                     GlobalTableFunctionState *gstate_p) {
+		return make_uniq<LocalState>(input.column_ids);
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Execute
+	//------------------------------------------------------------------------------------------------------------------
+
+	static void Execute(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
+		auto &bind_data = input.bind_data->Cast<BindData>();
+		auto &gstate = input.global_state->Cast<GlobalState>();
+		auto &lstate = input.local_state->Cast<LocalState>();
+
+		// Load the next subset of points into the output, moving to the next view or file when the current is done.
+		idx_t output_size = 0;
+
+		if (gstate.run.stream) {
+			output_size = PDAL_Utils::WriteStreamChunk(*gstate.run.stream, gstate.batch_idx, gstate.bindings, output);
+			output.SetCardinality(output_size);
+			return;
+		}
+
+		while (true) {
+			if (lstate.run.stream) {
+				output_size = PDAL_Utils::WriteStreamChunk(*lstate.run.stream, lstate.batch_idx, lstate.bindings,
+				                                           output);
+			} else if (lstate.view) {
+				auto &table = lstate.run.table ? *lstate.run.table : *gstate.run.table;
+
+				// Release the points copied to the output, freeing the blocks of the table no longer referenced.
+				const pdal::PointId begin = lstate.point_idx;
+				output_size = PDAL_Utils::WriteViewChunk(*lstate.view, lstate.point_idx, lstate.bindings, output);
+				table.Release(*lstate.view, begin, lstate.point_idx);
+			}
+			if (output_size > 0 || !lstate.Next(bind_data, gstate)) {
+				break;
+			}
+		}
+
+		// Set the cardinality of the output
+		output.SetCardinality(output_size);
+	};
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Partition Data
+	//------------------------------------------------------------------------------------------------------------------
+
+	// The view or the morsel of each chunk is used as batch index, so the insertion order is kept when scanning in
+	// parallel.
+	static OperatorPartitionData GetPartitionData(ClientContext &context, TableFunctionGetPartitionInput &input) {
+		if (input.partition_info.RequiresPartitionColumns()) {
+			throw InternalException("PDAL_Pipeline::GetPartitionData: partition columns not supported");
+		}
+		auto &lstate = input.local_state->Cast<LocalState>();
+		return OperatorPartitionData(lstate.batch_index);
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Cardinality
+	//------------------------------------------------------------------------------------------------------------------
+
+	static unique_ptr<NodeStatistics> Cardinality(ClientContext &context, const FunctionData *data) {
+
+		auto &bind_data = data->Cast<BindData>();
+		auto result = make_uniq<NodeStatistics>();
+
+		// This is the number of points of the input files, only an estimate since the stages of the pipeline may drop
+		// points or add new ones (e.g. filters.splitter with a buffer, filters.merge or extra readers).
+		if (bind_data.has_point_count) {
+			result->has_estimated_cardinality = true;
+			result->estimated_cardinality = bind_data.point_count;
+		}
+
+		return result;
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Replacement Scan
+	//------------------------------------------------------------------------------------------------------------------
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Documentation
+	//------------------------------------------------------------------------------------------------------------------
+
+	static constexpr auto DESCRIPTION = R"(
+		Read and import a variety of point cloud data file formats using the PDAL library,
+		applying also a custom processing pipeline to the data.
+
+		The pipeline can be provided either as a JSON file or as an inline JSON string. If the second parameter value
+		starts with "[" and ends with "]", it represents an inline JSON, otherwise it is a file path.
+
+		All the point views created by the pipeline are returned, the "view_id" column tells them apart with the
+		ordinal of the view in the result of each run of the pipeline (0 to n-1). Pipelines that PDAL can run in stream mode are streamed in batches, with "view_id" set to 0.
+
+		The input can be a glob pattern or a list of files, the pipeline runs once per file in parallel. A single file
+		runs on one thread, only the scan of its views is parallel. The optional filename parameter adds the path of
+		each file as a column.
+
+		The optional tile_size parameter splits the files in XY tiles, the pipeline runs once per tile in parallel and
+		only the points of each tile are returned. COPC and EPT readers only load the points of each tile, other
+		readers read the whole file for each tile, so their files are limited to 16 tiles. The optional buffer
+		parameter reads a halo of points around each tile, set it to the neighborhood radius of the filters (e.g.
+		filters.outlier or filters.smrf) to get the same results as the untiled run. Filters based on global statistics of the points may still differ. The points
+		are assigned to their tile by their input coordinates, before the stages of the pipeline move them.
+	)";
+
+	static constexpr auto EXAMPLE = R"(
+		SELECT * FROM PDAL_Pipeline('path/to/your/filename.las', 'path/to/your/pipeline.json');
+		SELECT * FROM PDAL_Pipeline('path/to/your/filename.las', '[ {"type": "filters.tail", "count": 100} ]');
+		SELECT * FROM PDAL_Pipeline('path/to/tiles/*.laz', 'path/to/your/pipeline.json', filename => true);
+		SELECT * FROM PDAL_Pipeline('path/to/your/filename.laz', 'path/to/smrf.json', tile_size => 500, buffer => 50);
+	)";
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Register
+	//------------------------------------------------------------------------------------------------------------------
+
+	static void Register(ExtensionLoader &loader) {
+
+		InsertionOrderPreservingMap<string> tags;
+		tags.insert("ext", "pdal");
+		tags.insert("category", "table");
+
+		TableFunctionSet func_set("PDAL_Pipeline");
+
+		// A single file or glob pattern, or a list of them
+		for (const auto &input_type : {LogicalType::VARCHAR, LogicalType::LIST(LogicalType::VARCHAR)}) {
+			TableFunction func("PDAL_Pipeline", {input_type, LogicalType::VARCHAR}, Execute, Bind, InitGlobal,
+			                   InitLocal);
+
+			func.cardinality = Cardinality;
+			func.get_partition_data = GetPartitionData;
+			func.projection_pushdown = true;
+			func.named_parameters["options"] = LogicalType::MAP(LogicalType::VARCHAR, LogicalType::VARCHAR);
+			func.named_parameters["filename"] = LogicalType::BOOLEAN;
+			func.named_parameters["geometry"] = LogicalType::BOOLEAN;
+			func.named_parameters["tile_size"] = LogicalType::DOUBLE;
+			func.named_parameters["buffer"] = LogicalType::DOUBLE;
+
+			func_set.AddFunction(func);
+		}
+
+		RegisterFunction<TableFunctionSet>(loader, func_set, CatalogType::TABLE_FUNCTION_ENTRY, DESCRIPTION, EXAMPLE,
+		                                   tags);
+	}
+};
+
+//======================================================================================================================
+// PDAL_Write
+//======================================================================================================================
+
+struct PDAL_Write {
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Bind
+	//------------------------------------------------------------------------------------------------------------------
+
+	// How the timestamps are written as GPS time.
+	enum class GpsTimeFormat : uint8_t {
+		// The seconds since the GPS epoch.
+		STANDARD,
+		// The seconds since the GPS epoch minus 1e9, in LAS files with the bit 0 of the global encoding set.
+		ADJUSTED_STANDARD,
+		// The seconds since the start of the GPS week, in LAS files with the bit 0 of the global encoding clear.
+		WEEK
+	};
+
+	struct BindData : public TableFunctionData {
+
+		string file_name;
+		vector<LogicalType> field_sql_types;
+		vector<string> field_names;
+		std::vector<idx_t> field_indexes;
+
+		// The writers are created for each output file, PARTITION_BY and tiles write several files.
+		std::string driver_name;
+		pdal::Options writer_options;
+		bool streaming = false;
+		// The GPS time written for the timestamps, which depends on the global encoding of the LAS files.
+		GpsTimeFormat gps_time_format = GpsTimeFormat::STANDARD;
+
+		// Slots of the streamed writers, the files opened when all are taken are buffered.
+		std::shared_ptr<StreamingWriterSlots> streaming_slots;
+
+		// Size of the XY tiles the rows are routed into, zero to write a single file.
+		double tile_size = 0;
+		idx_t max_open_writers = DEFAULT_MAX_OPEN_WRITERS;
+		idx_t x_column = 0;
+		idx_t y_column = 0;
+
+		BindData(string file_name, vector<LogicalType> field_sql_types, vector<string> field_names)
+		    : file_name(std::move(file_name)), field_sql_types(std::move(field_sql_types)),
+		      field_names(std::move(field_names)) {
+		}
+	};
+
+	// Default maximum number of tile files written by a copy.
+	static constexpr idx_t DEFAULT_MAX_OPEN_WRITERS = 100;
+
+	// Maximum number of streamed files written at the same time per DuckDB thread, by the tiles and the partitions of
+	// a copy. Each streamed writer runs on its own thread with a queue of point batches, so their number is bounded by
+	// the threads of the database. The files opened above the limit are buffered instead.
+	static constexpr idx_t MAX_STREAMING_WRITERS_PER_THREAD = 2;
+
+	// The streamed writers open at the same time by a copy, shared by all its files.
+	struct StreamingWriterSlots {
+		mutex lock;
+		idx_t open = 0;
+		idx_t limit = 0;
+
+		bool TryAcquire() {
+			lock_guard<mutex> guard(lock);
+			if (open >= limit) {
+				return false;
+			}
+			open++;
+			return true;
+		}
+
+		void Release() {
+			lock_guard<mutex> guard(lock);
+			open--;
+		}
+	};
+
+	// Find the copied column of a dimension, returns false if there is none.
+	static bool FindFieldColumn(const BindData &bind_data, const string &name, idx_t &column_idx) {
+		for (const auto &col_idx : bind_data.field_indexes) {
+			if (StringUtil::CIEquals(bind_data.field_names[col_idx], name)) {
+				column_idx = col_idx;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	static unique_ptr<FunctionData> Bind(ClientContext &context, CopyFunctionBindInput &input,
+	                                     const vector<string> &names, const vector<LogicalType> &sql_types) {
+
+		auto bind_data = make_uniq<BindData>(input.info.file_path, sql_types, names);
+
+		std::string file_name = input.info.file_path;
+		std::string driver_name;
+		bool streaming = true;
+		bool auto_options = false;
+
+		pdal::Options writer_options;
+
+		// Check all the options in the copy info and set.
+
+		for (auto &option : input.info.options) {
+			if (StringUtil::Upper(option.first) == "DRIVER") {
+				auto set = option.second.front();
+				if (set.type().id() == LogicalTypeId::VARCHAR) {
+					driver_name = StringUtil::Lower(set.GetValue<string>());
+
+					if (!StringUtil::StartsWith(driver_name, "writers.")) {
+						driver_name = "writers." + driver_name;
+					}
+				} else {
+					throw BinderException("Driver name must be a string");
+				}
+			} else if (StringUtil::Upper(option.first) == "CREATION_OPTIONS") {
+				auto set = option.second;
+				for (auto &s : set) {
+					if (s.type().id() != LogicalTypeId::VARCHAR) {
+						throw BinderException("Creation options must be strings");
+					}
+					auto kv_pair = StringUtil::Split(s.GetValue<string>(), '=');
+					if (kv_pair.size() != 2) {
+						throw InvalidInputException("Invalid input passed to options parameter");
+					}
+					writer_options.add(StringUtil::Lower(kv_pair[0]), kv_pair[1]);
+
+					if (StringUtil::Lower(kv_pair[1]) == "auto") {
+						auto_options = true;
+					}
+				}
+			} else if (StringUtil::Upper(option.first) == "STREAMING") {
+				if (!option.second.empty()) {
+					streaming = option.second.front().GetValue<bool>();
+				}
+			} else if (StringUtil::Upper(option.first) == "TILE_SIZE") {
+				if (option.second.empty() || option.second.front().IsNull()) {
+					throw BinderException("Tile size must be a number");
+				}
+				bind_data->tile_size = option.second.front().GetValue<double>();
+
+				if (!(bind_data->tile_size > 0)) {
+					throw BinderException("Tile size must be greater than zero");
+				}
+			} else if (StringUtil::Upper(option.first) == "MAX_OPEN_WRITERS") {
+				if (option.second.empty() || option.second.front().IsNull()) {
+					throw BinderException("Max open writers must be a number");
+				}
+				const auto max_open_writers = option.second.front().GetValue<int64_t>();
+
+				if (max_open_writers < 1) {
+					throw BinderException("Max open writers must be greater than zero");
+				}
+				bind_data->max_open_writers = static_cast<idx_t>(max_open_writers);
+			} else {
+				throw BinderException("Unknown option '%s'", option.first);
+			}
+		}
+
+		if (driver_name.empty()) {
+			driver_name = pdal::StageFactory::inferWriterDriver(file_name);
+		}
+		if (driver_name.empty()) {
+			throw BinderException(
+			    "Driver name must be specified when it can not be inferred from the file name, e.g. with PARTITION_BY");
+		}
+
+		// Name the files of the partitions after the driver, unless the FILE_EXTENSION option was given.
+
+		if (input.file_extension == "pdal") {
+			const auto extensions = pdal::StageFactory::extensions(driver_name);
+			if (!extensions.empty()) {
+				input.file_extension = extensions.front();
+			}
+		}
+
+		// Check the driver, the writers themselves are created for each output file.
+
+		std::unique_ptr<pdal::Stage> writer = pdal::PluginManager<pdal::Stage>::createObject(driver_name);
+		if (!writer) {
+			throw InvalidInputException("Driver not found for file: %s", file_name);
+		}
+
+		// Stream the points to the writer as they arrive when it supports it, but the "auto" scales and offsets
+		// are computed from all the points before writing them.
+		bind_data->streaming = streaming && !auto_options && dynamic_cast<pdal::Streamable *>(writer.get());
+		bind_data->driver_name = driver_name;
+
+		// Map the SQL types to PDAL types, reporting the columns that are skipped.
+
+		pdal::PointTable layout_table;
+		auto &logger = Logger::Get(context);
+
+		std::vector<idx_t> field_indexes = PDAL_Utils::FillLayout(layout_table.layout(), sql_types, names, logger);
+		bind_data->field_indexes = std::move(field_indexes);
+
+		// LAS files store GPS week time unless the bit 0 of their global encoding is set, which loses the date of the
+		// timestamps, so they are written as adjusted standard GPS time unless a global encoding is given.
+
+		if (driver_name == "writers.las") {
+			if (!writer_options.hasOption("global_encoding") && HasTimestamp(*bind_data)) {
+				writer_options.add("global_encoding", "1");
+			}
+			bind_data->gps_time_format =
+			    IsAdjustedGpsTime(writer_options.getValueOrDefault<std::string>("global_encoding", "0"))
+			        ? GpsTimeFormat::ADJUSTED_STANDARD
+			        : GpsTimeFormat::WEEK;
+		}
+		bind_data->writer_options = writer_options;
+
+		if (bind_data->tile_size > 0) {
+			if (!FindFieldColumn(*bind_data, "X", bind_data->x_column) ||
+			    !FindFieldColumn(*bind_data, "Y", bind_data->y_column)) {
+				throw BinderException("Tile size requires the X and Y columns");
+			}
+		}
+
+		const auto thread_count = static_cast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+		bind_data->streaming_slots = std::make_shared<StreamingWriterSlots>();
+		bind_data->streaming_slots->limit = MAX_STREAMING_WRITERS_PER_THREAD * MaxValue<idx_t>(1, thread_count);
+
+		// Return bind data.
+
+		return std::move(bind_data);
+	}
+
+	// A column of the input bound to a field of the points.
+	struct FieldBinding {
+		idx_t column_idx;
+		LogicalTypeId sql_type;
+		pdal::Dimension::Id dim_id;
+		pdal::Dimension::Type type;
+		std::size_t offset;
+		// The GPS time written, for timestamps.
+		GpsTimeFormat gps_time_format;
+	};
+
+	static bool IsTimestamp(LogicalTypeId sql_type) {
+		return sql_type == LogicalTypeId::TIMESTAMP || sql_type == LogicalTypeId::TIMESTAMP_TZ;
+	}
+
+	// Returns true if a timestamp column is written.
+	static bool HasTimestamp(const BindData &bind_data) {
+		for (const auto &col_idx : bind_data.field_indexes) {
+			if (IsTimestamp(bind_data.field_sql_types[col_idx].id())) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Bind the columns of the input to the fields of a finalized layout.
+	static std::vector<FieldBinding> BindFields(const BindData &bind_data, const pdal::PointLayoutPtr layout) {
+		std::vector<FieldBinding> bindings;
+
+		for (const auto &col_idx : bind_data.field_indexes) {
+			const pdal::Dimension::Id dim_id = layout->findDim(bind_data.field_names[col_idx]);
+			const pdal::Dimension::Detail *detail = layout->dimDetail(dim_id);
+
+			FieldBinding binding;
+			binding.column_idx = col_idx;
+			binding.sql_type = bind_data.field_sql_types[col_idx].id();
+			binding.dim_id = dim_id;
+			binding.type = detail->type();
+			binding.offset = static_cast<std::size_t>(detail->offset());
+			binding.gps_time_format = bind_data.gps_time_format;
+
+			if (IsTimestamp(binding.sql_type) && binding.type != pdal::Dimension::Type::Double) {
+				throw InvalidInputException("Timestamps can only be written into dimensions of type double");
+			}
+			bindings.push_back(binding);
+		}
+		return bindings;
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Point Buffers
+	//------------------------------------------------------------------------------------------------------------------
+
+	// The points written by a thread or a batch, in its own table because PDAL tables are not thread-safe.
+	struct PointBuffer {
+		std::unique_ptr<pdal::PointTable> table;
+		pdal::PointViewPtr view;
+		// The columns of the input bound to the fields of the table, bound once when the buffer is created.
+		std::vector<FieldBinding> bindings;
+	};
+
+	// Create a buffer with the layout of a writer, the dimensions are registered in the same order so they get the
+	// same ids in every table.
+	static std::unique_ptr<PointBuffer> CreateBuffer(const BindData &bind_data,
+	                                                 const pdal::PointLayoutPtr source_layout) {
+		auto buffer = std::make_unique<PointBuffer>();
+		buffer->table = std::make_unique<pdal::PointTable>();
+
+		pdal::PointLayoutPtr layout = buffer->table->layout();
+
+		for (const auto &dim_id : source_layout->dims()) {
+			layout->registerOrAssignDim(source_layout->dimName(dim_id), source_layout->dimType(dim_id));
+		}
+		buffer->table->finalize();
+		buffer->view = std::make_shared<pdal::PointView>(*buffer->table);
+		buffer->bindings = BindFields(bind_data, layout);
+		return buffer;
+	}
+
+	// Check that a buffer has the dimensions of a writer with the same ids and types, the writer reads the fields of
+	// the views of the buffer by the ids of its own layout.
+	static void CheckBufferLayout(const pdal::PointLayoutPtr writer_layout, const PointBuffer &buffer) {
+		const pdal::PointLayoutPtr buffer_layout = buffer.table->layout();
+
+		for (const auto &dim_id : writer_layout->dims()) {
+			const pdal::Dimension::Id buffer_id = buffer_layout->findDim(writer_layout->dimName(dim_id));
+
+			if (buffer_id != dim_id || buffer_layout->dimType(buffer_id) != writer_layout->dimType(dim_id)) {
+				throw InternalException("PDAL_Write: layout of the point buffer differs from the writer in '%s'",
+				                        writer_layout->dimName(dim_id));
+			}
+		}
+	}
+
+	// Copy a column of the input into a field of a set of packed points, NULLs are written as zero.
+	template <class T>
+	static void CopyField(Vector &source, idx_t count, char *const *points, std::size_t offset) {
+		UnifiedVectorFormat format;
+		source.ToUnifiedFormat(count, format);
+		const T *data = UnifiedVectorFormat::GetData<T>(format);
+
+		for (idx_t i = 0; i < count; i++) {
+			const auto idx = format.sel->get_index(i);
+			const T value = format.validity.RowIsValid(idx) ? data[idx] : T(0);
+			std::memcpy(points[i] + offset, &value, sizeof(T));
+		}
+	}
 
-	static void Execute(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
-		auto &bind_data = (BindData &)*input.bind_data;
-		auto &gstate = input.global_state->Cast<GlobalState>();
+	// Seconds between the GPS epoch (1980-01-06) and the Unix epoch.
+	static constexpr int64_t GPS_EPOCH_OFFSET = 315964800;
 
-		// Calculate how many record we can fit in the output
-		const auto output_size = std::min<idx_t>(STANDARD_VECTOR_SIZE, bind_data.point_count - gstate.point_idx);
-		const auto record_start = gstate.point_idx;
+	// Adjusted standard GPS time is the GPS time minus 1e9 seconds.
+	static constexpr double ADJUSTED_GPS_TIME_OFFSET = 1e9;
 
-		if (output_size == 0) {
-			output.SetCardinality(0);
-			return;
+	// Seconds in a GPS week, the GPS week time is the GPS time modulo a week.
+	static constexpr double GPS_WEEK_SECONDS = 604800;
+
+	// Returns true if a global encoding option of the LAS writer sets bit 0, the adjusted standard GPS time. The
+	// invalid values are left to the writer to report.
+	static bool IsAdjustedGpsTime(const std::string &global_encoding) {
+		try {
+			return (std::stoul(global_encoding, nullptr, 0) & 1) != 0;
+		} catch (std::exception &) {
+			return false;
 		}
+	}
 
-		// Load current subset of points into the output.
-		pdal::PointViewPtr view = *(bind_data.pipeline->views().begin());
-		PDAL_Utils::WriteOutputChunk(view, record_start, output_size, output);
+	// Get the number of leap seconds between GPS time and UTC at a Unix time.
+	static int64_t GpsLeapSeconds(int64_t unix_seconds) {
+		// Unix times at which a leap second was inserted since the GPS epoch
+		static constexpr int64_t LEAP_SECONDS[] = {
+		    362793600,  394329600,  425865600,  489024000,  567993600,  631152000,
+		    662688000,  709948800,  741484800,  773020800,  820454400,  867715200,
+		    915148800,  1136073600, 1230768000, 1341100800, 1435708800, 1483228800};
+
+		int64_t leap_seconds = 0;
+		for (const auto &leap_time : LEAP_SECONDS) {
+			if (unix_seconds >= leap_time) {
+				leap_seconds++;
+			}
+		}
+		return leap_seconds;
+	}
 
-		// Update the point index
-		gstate.point_idx += output_size;
+	// Convert a timestamp column of the input into a flat vector of GPS times, NULLs are converted to zero.
+	static void ConvertGpsTime(Vector &source, Vector &target, idx_t count, GpsTimeFormat gps_time_format) {
+		UnifiedVectorFormat format;
+		source.ToUnifiedFormat(count, format);
+		const timestamp_t *data = UnifiedVectorFormat::GetData<timestamp_t>(format);
+		double *target_data = FlatVector::GetData<double>(target);
+
+		for (idx_t i = 0; i < count; i++) {
+			const auto idx = format.sel->get_index(i);
+			double value = 0;
+
+			if (format.validity.RowIsValid(idx) && Timestamp::IsFinite(data[idx])) {
+				const int64_t micros = Timestamp::GetEpochMicroSeconds(data[idx]);
+				const int64_t seconds = micros / Interval::MICROS_PER_SEC;
+				value = static_cast<double>(micros) / Interval::MICROS_PER_SEC - GPS_EPOCH_OFFSET +
+				        static_cast<double>(GpsLeapSeconds(seconds));
+
+				if (gps_time_format == GpsTimeFormat::ADJUSTED_STANDARD) {
+					value -= ADJUSTED_GPS_TIME_OFFSET;
+				} else if (gps_time_format == GpsTimeFormat::WEEK) {
+					value -= std::floor(value / GPS_WEEK_SECONDS) * GPS_WEEK_SECONDS;
+				}
+			}
+			target_data[i] = value;
+		}
+	}
 
-		// Set the cardinality of the output
-		output.SetCardinality(output_size);
-	};
+	// Copy a column of the input into a field of a set of packed points, casting it first to the type of the field.
+	static void CopyColumn(ClientContext &context, const FieldBinding &binding, Vector &source, idx_t count,
+	                       char *const *points) {
 
-	//------------------------------------------------------------------------------------------------------------------
-	// Cardinality
-	//------------------------------------------------------------------------------------------------------------------
+		if (IsTimestamp(binding.sql_type)) {
+			Vector gps_time(LogicalType::DOUBLE, count);
+			ConvertGpsTime(source, gps_time, count, binding.gps_time_format);
+			CopyField<double>(gps_time, count, points, binding.offset);
+			return;
+		}
 
-	static unique_ptr<NodeStatistics> Cardinality(ClientContext &context, const FunctionData *data) {
+		// e.g. DECIMAL to DOUBLE, BOOLEAN to UTINYINT
+		const LogicalType field_type = PDAL_Utils::DimensionType(binding.type);
+		if (source.GetType() != field_type) {
+			Vector cast_vector(field_type, count);
+			VectorOperations::Cast(context, source, cast_vector, count);
+			CopyColumn(context, binding, cast_vector, count, points);
+			return;
+		}
 
-		auto &bind_data = data->Cast<BindData>();
-		auto result = make_uniq<NodeStatistics>();
+		switch (binding.type) {
+		case pdal::Dimension::Type::Float:
+			CopyField<float>(source, count, points, binding.offset);
+			break;
+		case pdal::Dimension::Type::Double:
+			CopyField<double>(source, count, points, binding.offset);
+			break;
+		case pdal::Dimension::Type::Signed8:
+			CopyField<int8_t>(source, count, points, binding.offset);
+			break;
+		case pdal::Dimension::Type::Signed16:
+			CopyField<int16_t>(source, count, points, binding.offset);
+			break;
+		case pdal::Dimension::Type::Signed32:
+			CopyField<int32_t>(source, count, points, binding.offset);
+			break;
+		case pdal::Dimension::Type::Signed64:
+			CopyField<int64_t>(source, count, points, binding.offset);
+			break;
+		case pdal::Dimension::Type::Unsigned8:
+			CopyField<uint8_t>(source, count, points, binding.offset);
+			break;
+		case pdal::Dimension::Type::Unsigned16:
+			CopyField<uint16_t>(source, count, points, binding.offset);
+			break;
+		case pdal::Dimension::Type::Unsigned32:
+			CopyField<uint32_t>(source, count, points, binding.offset);
+			break;
+		case pdal::Dimension::Type::Unsigned64:
+			CopyField<uint64_t>(source, count, points, binding.offset);
+			break;
+		default:
+			throw InvalidInputException("Unsupported PDAL dimension type in write: %d.",
+			                            static_cast<int>(binding.type));
+		}
+	}
 
-		// This is the maximum number of points in a single file
-		result->has_max_cardinality = true;
-		result->max_cardinality = bind_data.point_count;
+	// Append the rows of a chunk to the points of a buffer, column by column.
+	static void AppendChunk(ClientContext &context, PointBuffer &buffer, DataChunk &input) {
 
-		return result;
-	}
+		pdal::PointLayoutPtr layout = buffer.view->layout();
+		pdal::PointView *view = buffer.view.get();
 
-	//------------------------------------------------------------------------------------------------------------------
-	// Replacement Scan
-	//------------------------------------------------------------------------------------------------------------------
+		const idx_t count = input.size();
+		if (count == 0 || layout->dims().empty()) {
+			return;
+		}
 
-	//------------------------------------------------------------------------------------------------------------------
-	// Documentation
-	//------------------------------------------------------------------------------------------------------------------
+		// Add the points to the view, zeroed so the fields without column are written as zero. A PDAL view only grows
+		// one point at a time, by setting a field of the point past its end, and the packed data of a point is only
+		// valid once it is added, so the points are added row by row before their pointers are taken.
+		const pdal::Dimension::Id first_dim = layout->dims().front();
+		const pdal::Dimension::Type first_type = layout->dimType(first_dim);
+		const uint64_t zero = 0;
 
-	static constexpr auto DESCRIPTION = R"(
-		Read and import a variety of point cloud data file formats using the PDAL library,
-		applying also a custom processing pipeline to the data.
+		const pdal::PointId record_start = view->size();
+		char *points[STANDARD_VECTOR_SIZE];
 
-		The pipeline can be provided either as a JSON file or as an inline JSON string. If the second parameter value
-		starts with "[" and ends with "]", it represents an inline JSON, otherwise it is a file path.
-	)";
+		for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+			view->setField(first_dim, first_type, record_start + row_idx, &zero);
+			points[row_idx] = view->getPoint(record_start + row_idx);
+			std::memset(points[row_idx], 0, layout->pointSize());
+		}
 
-	static constexpr auto EXAMPLE = R"(
-		SELECT * FROM PDAL_Pipeline('path/to/your/filename.las', 'path/to/your/pipeline.json');
-		SELECT * FROM PDAL_Pipeline('path/to/your/filename.las', '[ {"type": "filters.tail", "count": 100} ]');
-	)";
+		// Write the points into the output
+		for (const auto &binding : buffer.bindings) {
+			CopyColumn(context, binding, input.data[binding.column_idx], count, points);
+		}
+	}
 
 	//------------------------------------------------------------------------------------------------------------------
-	// Register
+	// Streamed Batches
 	//------------------------------------------------------------------------------------------------------------------
 
-	static void Register(ExtensionLoader &loader) {
-
-		InsertionOrderPreservingMap<string> tags;
-		tags.insert("ext", "pdal");
-		tags.insert("category", "table");
-
-		TableFunction func("PDAL_Pipeline", {LogicalType::VARCHAR, LogicalType::VARCHAR}, Execute, Bind, InitGlobal);
+	// Copy the rows of a chunk into the packed points of a batch of the streamed writer, column by column. The batch
+	// is queued without waiting for the writer, so the threads sinking rows only wait when the queue is full.
+	static void AppendBatch(ClientContext &context, const std::vector<FieldBinding> &bindings, PdalPointBatch &batch,
+	                        DataChunk &input) {
 
-		func.cardinality = Cardinality;
-		func.named_parameters["options"] = LogicalType::MAP(LogicalType::VARCHAR, LogicalType::VARCHAR);
+		const idx_t count = input.size();
+		if (count == 0) {
+			return;
+		}
+		char *first_point = batch.Append(count);
+		char *points[STANDARD_VECTOR_SIZE];
 
-		RegisterFunction<TableFunction>(loader, func, CatalogType::TABLE_FUNCTION_ENTRY, DESCRIPTION, EXAMPLE, tags);
+		for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+			points[row_idx] = first_point + row_idx * batch.PointSize();
+		}
+		for (const auto &binding : bindings) {
+			CopyColumn(context, binding, input.data[binding.column_idx], count, points);
+		}
 	}
-};
-
-//======================================================================================================================
-// PDAL_Write
-//======================================================================================================================
 
-struct PDAL_Write {
+	// Write a chunk into the streamed writer of a file.
+	static void PushChunk(ClientContext &context, PdalPointSink &sink, const std::vector<FieldBinding> &bindings,
+	                      DataChunk &chunk) {
+		if (chunk.size() == 0) {
+			return;
+		}
+		auto batch = sink.NewBatch();
+		AppendBatch(context, bindings, *batch, chunk);
+		sink.Push(std::move(batch));
+	}
 
 	//------------------------------------------------------------------------------------------------------------------
-	// Bind
+	// File Writers
 	//------------------------------------------------------------------------------------------------------------------
 
-	struct BindData : public TableFunctionData {
-
+	// The PDAL writer of an output file.
+	struct FileWriter {
 		string file_name;
-		vector<LogicalType> field_sql_types;
-		vector<string> field_names;
-		std::vector<idx_t> field_indexes;
+		std::unique_ptr<pdal::Stage> writer;
 
-		std::unique_ptr<pdal::StageFactory> stage_factory;
+		// Buffered mode: the writer reads all the points from a buffer reader when the file is finished.
 		std::unique_ptr<pdal::BufferReader> reader;
-		pdal::Stage *writer = nullptr;
 		std::unique_ptr<pdal::PointTable> table;
-		std::shared_ptr<pdal::PointView> view;
+		std::vector<std::unique_ptr<PointBuffer>> buffers;
+
+		// Streaming mode: the writer runs in a background thread while the points are sent in batches. Declared
+		// after the writer, so the thread is stopped before the writer is destroyed.
+		std::unique_ptr<PdalPointSink> sink;
+		std::vector<FieldBinding> sink_bindings;
+		// The slot taken by the streamed writer, released when the file is finished.
+		std::shared_ptr<StreamingWriterSlots> slots;
+
+		// Serializes the threads adding buffers or, for tiles, opening the file and writing chunks into it.
+		mutex lock;
+		bool open = false;
+		bool finished = false;
+
+		~FileWriter() {
+			ReleaseSlot();
+		}
 
-		BindData(string file_name, vector<LogicalType> field_sql_types, vector<string> field_names)
-		    : file_name(std::move(file_name)), field_sql_types(std::move(field_sql_types)),
-		      field_names(std::move(field_names)) {
+		pdal::PointLayoutPtr Layout() const {
+			return sink ? sink->Table().layout() : table->layout();
 		}
-	};
 
-	static unique_ptr<FunctionData> Bind(ClientContext &context, CopyFunctionBindInput &input,
-	                                     const vector<string> &names, const vector<LogicalType> &sql_types) {
+		void ReleaseSlot() {
+			if (slots) {
+				slots->Release();
+				slots.reset();
+			}
+		}
+	};
 
-		auto bind_data = make_uniq<BindData>(input.info.file_path, sql_types, names);
+	// Open the writer of a file, and register the dimensions of the copied columns into its layout.
+	static void OpenFileWriter(const BindData &bind_data, FileWriter &file_writer) {
+		const string &file_name = file_writer.file_name;
 
-		std::string file_name = input.info.file_path;
-		std::string driver_name;
+		file_writer.writer = pdal::PluginManager<pdal::Stage>::createObject(bind_data.driver_name);
+		if (!file_writer.writer) {
+			throw InvalidInputException("Driver not found for file: %s", file_name);
+		}
+		pdal::Stage &writer = *file_writer.writer;
 
-		pdal::Options writer_options;
+		pdal::Options writer_options = bind_data.writer_options;
 		writer_options.add("filename", file_name);
 
-		// Check all the options in the copy info and set.
+		if (bind_data.streaming && bind_data.streaming_slots->TryAcquire()) {
+			file_writer.slots = bind_data.streaming_slots;
+			file_writer.sink = std::make_unique<PdalPointSink>();
 
-		for (auto &option : input.info.options) {
-			if (StringUtil::Upper(option.first) == "DRIVER") {
-				auto set = option.second.front();
-				if (set.type().id() == LogicalTypeId::VARCHAR) {
-					driver_name = StringUtil::Lower(set.GetValue<string>());
+			writer.setInput(file_writer.sink->Reader());
+			writer.setOptions(writer_options);
+			writer.prepare(file_writer.sink->Table());
+		} else {
+			file_writer.reader = std::make_unique<pdal::BufferReader>();
+			file_writer.table = std::make_unique<pdal::PointTable>();
 
-					if (!StringUtil::StartsWith(driver_name, "writers.")) {
-						driver_name = "writers." + driver_name;
-					}
-				} else {
-					throw BinderException("Driver name must be a string");
-				}
-			} else if (StringUtil::Upper(option.first) == "CREATION_OPTIONS") {
-				auto set = option.second;
-				for (auto &s : set) {
-					if (s.type().id() != LogicalTypeId::VARCHAR) {
-						throw BinderException("Creation options must be strings");
-					}
-					auto kv_pair = StringUtil::Split(s.GetValue<string>(), '=');
-					if (kv_pair.size() != 2) {
-						throw InvalidInputException("Invalid input passed to options parameter");
-					}
-					writer_options.add(StringUtil::Lower(kv_pair[0]), kv_pair[1]);
-				}
-			} else {
-				throw BinderException("Unknown option '%s'", option.first);
-			}
+			writer.setInput(*file_writer.reader);
+			writer.setOptions(writer_options);
+			writer.prepare(*file_writer.table);
 		}
 
-		if (driver_name.empty()) {
-			driver_name = pdal::StageFactory::inferWriterDriver(file_name);
+		// Fill the layout by mapping SQL types to PDAL types.
+
+		pdal::PointLayoutPtr layout = file_writer.Layout();
+
+		for (const auto &col_idx : bind_data.field_indexes) {
+			pdal::Dimension::Type type;
+			PDAL_Utils::FieldType(bind_data.field_sql_types[col_idx], type);
+			layout->registerOrAssignDim(bind_data.field_names[col_idx], type);
 		}
-		if (driver_name.empty()) {
-			throw BinderException("Driver name must be specified");
+
+		if (file_writer.sink) {
+			file_writer.sink->Start(writer);
+			file_writer.sink_bindings = BindFields(bind_data, layout);
 		}
+		file_writer.open = true;
+	}
 
-		// Create the PDAL reader & writer and prepare the target table.
+	// Create and open the writer of a file.
+	static std::unique_ptr<FileWriter> CreateFileWriter(const BindData &bind_data, const string &file_name) {
+		auto file_writer = std::make_unique<FileWriter>();
+		file_writer->file_name = file_name;
+		OpenFileWriter(bind_data, *file_writer);
+		return file_writer;
+	}
 
-		std::unique_ptr<pdal::StageFactory> stage_factory = std::make_unique<pdal::StageFactory>();
+	// Write a chunk into a file, the caller must hold the lock of the writer.
+	static void WriteChunk(ClientContext &context, const BindData &bind_data, FileWriter &file_writer,
+	                       DataChunk &chunk) {
 
-		std::unique_ptr<pdal::BufferReader> reader = std::make_unique<pdal::BufferReader>();
-		if (!reader) {
-			throw InvalidInputException("Driver 'readers.buffer' was not found in PDAL installation");
+		if (file_writer.sink) {
+			PushChunk(context, *file_writer.sink, file_writer.sink_bindings, chunk);
+			return;
 		}
 
-		pdal::Stage *writer = stage_factory->createStage(driver_name);
-		if (!writer) {
-			throw InvalidInputException("Driver not found for file: %s", file_name);
+		if (file_writer.buffers.empty()) {
+			file_writer.buffers.push_back(CreateBuffer(bind_data, file_writer.Layout()));
+		}
+		AppendChunk(context, *file_writer.buffers.back(), chunk);
+	}
+
+	// Write the buffered points of a file, or wait for the writer to write the streamed ones and patch the header.
+	static void FinishFileWriter(FileWriter &file_writer) {
+		file_writer.finished = true;
+
+		if (file_writer.sink) {
+			file_writer.sink->Finish();
+			file_writer.ReleaseSlot();
+			return;
 		}
 
-		std::unique_ptr<pdal::PointTable> table = std::make_unique<pdal::PointTable>();
-		std::shared_ptr<pdal::PointView> view = std::make_shared<pdal::PointView>(*table);
+		// The writer reads the views of all the buffers, an empty one if no rows were written.
+		pdal::PointTable *table = file_writer.table.get();
 
-		reader->addView(view);
-		writer->setInput(*reader);
-		writer->setOptions(writer_options);
-		writer->prepare(*table);
+		if (file_writer.buffers.empty()) {
+			file_writer.reader->addView(std::make_shared<pdal::PointView>(*table));
+		}
+		for (const auto &buffer : file_writer.buffers) {
+			CheckBufferLayout(table->layout(), *buffer);
+			file_writer.reader->addView(buffer->view);
+		}
 
-		// Fill the layout by mapping SQL types to PDAL types.
+		// Flush writer
+		file_writer.writer->execute(*table);
+	}
 
-		pdal::PointLayoutPtr layout = table->layout();
-		auto &logger = Logger::Get(context);
+	//------------------------------------------------------------------------------------------------------------------
+	// Tiles
+	//------------------------------------------------------------------------------------------------------------------
 
-		std::vector<idx_t> field_indexes = PDAL_Utils::FillLayout(layout, sql_types, names, logger);
-		bind_data->field_indexes = std::move(field_indexes);
+	// The column and row of a tile of the grid.
+	typedef std::pair<int64_t, int64_t> TileKey;
 
-		// Return bind data.
+	static string FormatCoordinate(double value) {
+		std::ostringstream stream;
+		stream.precision(15);
+		stream << value;
+		return stream.str();
+	}
 
-		bind_data->stage_factory = std::move(stage_factory);
-		bind_data->reader = std::move(reader);
-		bind_data->writer = writer;
-		bind_data->table = std::move(table);
-		bind_data->view = std::move(view);
+	// Get the file name of a tile, replacing the {x} and {y} placeholders with the coordinates of its lower left
+	// corner. They are appended to the name when missing.
+	static string TileFileName(const BindData &bind_data, const string &file_path, const TileKey &key) {
 
-		return std::move(bind_data);
+		string file_name = file_path;
+
+		if (file_name.find("{x}") == string::npos && file_name.find("{y}") == string::npos) {
+			const string suffix = "_{x}_{y}";
+			const auto separator_pos = file_name.find_last_of("/\\");
+			const auto extension_pos = file_name.find_last_of('.');
+
+			if (extension_pos != string::npos && (separator_pos == string::npos || extension_pos > separator_pos)) {
+				file_name.insert(extension_pos, suffix);
+			} else {
+				file_name += suffix;
+			}
+		}
+		file_name = StringUtil::Replace(file_name, "{x}", FormatCoordinate(key.first * bind_data.tile_size));
+		file_name = StringUtil::Replace(file_name, "{y}", FormatCoordinate(key.second * bind_data.tile_size));
+		return file_name;
+	}
+
+	// Get the tile of a coordinate, the points without a finite coordinate belong to no tile.
+	static int64_t TileIndex(bool valid, double value, double tile_size) {
+		const double index = valid ? std::floor(value / tile_size) : 0;
+
+		if (!valid || !std::isfinite(index) || std::abs(index) >= 9e18) {
+			throw InvalidInputException("TILE_SIZE requires finite and non NULL X and Y coordinates");
+		}
+		return static_cast<int64_t>(index);
 	}
 
 	//------------------------------------------------------------------------------------------------------------------
@@ -1282,13 +3854,119 @@ struct PDAL_Write {
 	//------------------------------------------------------------------------------------------------------------------
 
 	struct GlobalState final : GlobalFunctionData {
-		explicit GlobalState(ClientContext &context) {
+		// The writer of the output file, when the rows are not routed into tiles.
+		std::unique_ptr<FileWriter> file_writer;
+
+		// The path of the output file, with PARTITION_BY the path of the partition.
+		string file_path;
+
+		// The writers of the tiles, opened when their first rows arrive and kept open until the copy finishes, so
+		// each tile is written into a single file.
+		mutex lock;
+		std::map<TileKey, std::shared_ptr<FileWriter>> tiles;
+
+		GlobalState(ClientContext &context, string file_path_p) : file_path(std::move(file_path_p)) {
+		}
+
+		// Get the writer of a tile, opening it if the number of open tiles is below the limit. The writer is opened
+		// outside of the lock of the tiles, the threads writing into the same tile wait for it on the lock of the
+		// writer, and the other threads are not blocked by the I/O.
+		std::shared_ptr<FileWriter> GetTile(const BindData &bind_data, const TileKey &key) {
+			std::shared_ptr<FileWriter> result;
+			unique_lock<mutex> writer_guard;
+			{
+				lock_guard<mutex> guard(lock);
+
+				auto entry = tiles.find(key);
+				if (entry != tiles.end()) {
+					return entry->second;
+				}
+				if (tiles.size() >= bind_data.max_open_writers) {
+					throw InvalidInputException("TILE_SIZE %f writes more than %d tiles, raise MAX_OPEN_WRITERS to "
+					                            "write more tile files at the same time",
+					                            bind_data.tile_size, bind_data.max_open_writers);
+				}
+				result = std::make_shared<FileWriter>();
+				result->file_name = TileFileName(bind_data, file_path, key);
+				writer_guard = unique_lock<mutex>(result->lock);
+				tiles[key] = result;
+			}
+			OpenFileWriter(bind_data, *result);
+			return result;
+		}
+
+		static void CloseTile(FileWriter &file_writer) {
+			lock_guard<mutex> guard(file_writer.lock);
+
+			if (file_writer.open && !file_writer.finished) {
+				FinishFileWriter(file_writer);
+			}
 		}
 	};
 
+	// Route the rows of a chunk to the writers of their tiles.
+	static void RouteChunk(ClientContext &context, const BindData &bind_data, GlobalState &gstate, DataChunk &chunk) {
+
+		const idx_t count = chunk.size();
+		if (count == 0) {
+			return;
+		}
+
+		// Get the tile of each row
+		Vector x_vector(LogicalType::DOUBLE, count);
+		Vector y_vector(LogicalType::DOUBLE, count);
+		VectorOperations::Cast(context, chunk.data[bind_data.x_column], x_vector, count);
+		VectorOperations::Cast(context, chunk.data[bind_data.y_column], y_vector, count);
+
+		UnifiedVectorFormat x_format;
+		UnifiedVectorFormat y_format;
+		x_vector.ToUnifiedFormat(count, x_format);
+		y_vector.ToUnifiedFormat(count, y_format);
+		const double *x_data = UnifiedVectorFormat::GetData<double>(x_format);
+		const double *y_data = UnifiedVectorFormat::GetData<double>(y_format);
+
+		std::map<TileKey, std::pair<SelectionVector, idx_t>> selections;
+
+		for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+			const auto x_idx = x_format.sel->get_index(row_idx);
+			const auto y_idx = y_format.sel->get_index(row_idx);
+			const TileKey key(TileIndex(x_format.validity.RowIsValid(x_idx), x_data[x_idx], bind_data.tile_size),
+			                  TileIndex(y_format.validity.RowIsValid(y_idx), y_data[y_idx], bind_data.tile_size));
+
+			auto entry = selections.find(key);
+			if (entry == selections.end()) {
+				entry = selections.emplace(key, std::make_pair(SelectionVector(STANDARD_VECTOR_SIZE), 0)).first;
+			}
+			entry->second.first.set_index(entry->second.second++, row_idx);
+		}
+
+		// Write the rows of each tile
+		for (auto &entry : selections) {
+			DataChunk tile_chunk;
+			tile_chunk.InitializeEmpty(chunk.GetTypes());
+			tile_chunk.Slice(chunk, entry.second.first, entry.second.second);
+
+			auto file_writer = gstate.GetTile(bind_data, entry.first);
+			lock_guard<mutex> guard(file_writer->lock);
+
+			// The thread that opened the tile failed
+			if (!file_writer->open) {
+				throw IOException("Failed to open the tile file '%s'", file_writer->file_name);
+			}
+			WriteChunk(context, bind_data, *file_writer, tile_chunk);
+		}
+	}
+
 	static unique_ptr<GlobalFunctionData> InitGlobal(ClientContext &context, FunctionData &fdata,
 	                                                 const string &file_path) {
-		auto global_data = make_uniq<GlobalState>(context);
+		auto &bind_data = fdata.Cast<BindData>();
+
+		// The writers of the tiles are created when their first rows arrive
+		auto global_data = make_uniq<GlobalState>(context, file_path);
+
+		if (bind_data.tile_size <= 0) {
+			global_data->file_writer = CreateFileWriter(bind_data, file_path);
+		}
 		return std::move(global_data);
 	}
 
@@ -1297,6 +3975,7 @@ struct PDAL_Write {
 	//------------------------------------------------------------------------------------------------------------------
 
 	struct LocalState : public LocalFunctionData {
+		std::unique_ptr<PointBuffer> buffer;
 		explicit LocalState(ClientContext &context) {
 		}
 	};
@@ -1314,62 +3993,24 @@ struct PDAL_Write {
 	                 LocalFunctionData &lstate, DataChunk &input) {
 
 		auto &bind_data = fdata.Cast<BindData>();
+		auto &global_state = gstate.Cast<GlobalState>();
+		auto &local_state = lstate.Cast<LocalState>();
 
-		pdal::PointLayoutPtr layout = bind_data.view->layout();
-		pdal::PointView *view = bind_data.view.get();
-
-		std::vector<idx_t> &field_indexes = bind_data.field_indexes;
-		pdal::PointId record_start = view->size();
-
-		// Write the points into the output
-		input.Flatten();
-		for (idx_t row_idx = 0, col_idx = 0, field_idx = 0; row_idx < input.size(); row_idx++) {
-			field_idx = 0;
-
-			for (const auto &dimId : layout->dims()) {
-				const pdal::Dimension::Detail *detail = layout->dimDetail(dimId);
-				pdal::Dimension::Type t = detail->type();
+		if (bind_data.tile_size > 0) {
+			RouteChunk(context.client, bind_data, global_state, input);
+			return;
+		}
+		auto &file_writer = *global_state.file_writer;
 
-				col_idx = field_indexes[field_idx];
-				duckdb::Value value = input.GetValue(col_idx, row_idx);
+		if (file_writer.sink) {
+			PushChunk(context.client, *file_writer.sink, file_writer.sink_bindings, input);
+			return;
+		}
 
-				switch (t) {
-				case pdal::Dimension::Type::Float:
-					view->setField<float>(dimId, record_start + row_idx, value.GetValue<float>());
-					break;
-				case pdal::Dimension::Type::Double:
-					view->setField<double>(dimId, record_start + row_idx, value.GetValue<double>());
-					break;
-				case pdal::Dimension::Type::Signed8:
-					view->setField<int8_t>(dimId, record_start + row_idx, value.GetValue<int8_t>());
-					break;
-				case pdal::Dimension::Type::Signed16:
-					view->setField<int16_t>(dimId, record_start + row_idx, value.GetValue<int16_t>());
-					break;
-				case pdal::Dimension::Type::Signed32:
-					view->setField<int32_t>(dimId, record_start + row_idx, value.GetValue<int32_t>());
-					break;
-				case pdal::Dimension::Type::Signed64:
-					view->setField<int64_t>(dimId, record_start + row_idx, value.GetValue<int64_t>());
-					break;
-				case pdal::Dimension::Type::Unsigned8:
-					view->setField<uint8_t>(dimId, record_start + row_idx, value.GetValue<uint8_t>());
-					break;
-				case pdal::Dimension::Type::Unsigned16:
-					view->setField<uint16_t>(dimId, record_start + row_idx, value.GetValue<uint16_t>());
-					break;
-				case pdal::Dimension::Type::Unsigned32:
-					view->setField<uint32_t>(dimId, record_start + row_idx, value.GetValue<uint32_t>());
-					break;
-				case pdal::Dimension::Type::Unsigned64:
-					view->setField<uint64_t>(dimId, record_start + row_idx, value.GetValue<uint64_t>());
-					break;
-				default:
-					throw InvalidInputException("Unsupported PDAL dimension type in write: %d.", static_cast<int>(t));
-				}
-				field_idx++;
-			}
+		if (!local_state.buffer) {
+			local_state.buffer = CreateBuffer(bind_data, file_writer.Layout());
 		}
+		AppendChunk(context.client, *local_state.buffer, input);
 	}
 
 	//------------------------------------------------------------------------------------------------------------------
@@ -1378,6 +4019,94 @@ struct PDAL_Write {
 
 	static void Combine(ExecutionContext &context, FunctionData &fdata, GlobalFunctionData &gstate,
 	                    LocalFunctionData &lstate) {
+		auto &global_state = gstate.Cast<GlobalState>();
+		auto &local_state = lstate.Cast<LocalState>();
+
+		if (local_state.buffer) {
+			auto &file_writer = *global_state.file_writer;
+
+			lock_guard<mutex> guard(file_writer.lock);
+			file_writer.buffers.push_back(std::move(local_state.buffer));
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Batches
+	//------------------------------------------------------------------------------------------------------------------
+
+	struct BatchData final : PreparedBatchData {
+		std::unique_ptr<PointBuffer> buffer;
+		// The packed points of each chunk of the batch when streaming, queued when the batch is flushed.
+		std::vector<std::unique_ptr<PdalPointBatch>> point_batches;
+		// The rows of the batch when routing them into tiles, read when the batch is flushed.
+		unique_ptr<ColumnDataCollection> collection;
+	};
+
+	// The points of each batch are converted in parallel, and flushed in the order of the batches.
+	static unique_ptr<PreparedBatchData> PrepareBatch(ClientContext &context, FunctionData &fdata,
+	                                                  GlobalFunctionData &gstate,
+	                                                  unique_ptr<ColumnDataCollection> collection) {
+		auto &bind_data = fdata.Cast<BindData>();
+		auto &global_state = gstate.Cast<GlobalState>();
+
+		auto batch = make_uniq<BatchData>();
+		if (bind_data.tile_size > 0) {
+			batch->collection = std::move(collection);
+			return std::move(batch);
+		}
+		auto &file_writer = *global_state.file_writer;
+
+		if (file_writer.sink) {
+			for (auto &chunk : collection->Chunks()) {
+				auto point_batch = file_writer.sink->NewBatch();
+				AppendBatch(context, file_writer.sink_bindings, *point_batch, chunk);
+				batch->point_batches.push_back(std::move(point_batch));
+			}
+			return std::move(batch);
+		}
+		batch->buffer = CreateBuffer(bind_data, file_writer.Layout());
+
+		for (auto &chunk : collection->Chunks()) {
+			AppendChunk(context, *batch->buffer, chunk);
+		}
+		return std::move(batch);
+	}
+
+	static void FlushBatch(ClientContext &context, FunctionData &fdata, GlobalFunctionData &gstate,
+	                       PreparedBatchData &batch) {
+		auto &bind_data = fdata.Cast<BindData>();
+		auto &global_state = gstate.Cast<GlobalState>();
+		auto &batch_data = batch.Cast<BatchData>();
+
+		if (bind_data.tile_size > 0) {
+			for (auto &chunk : batch_data.collection->Chunks()) {
+				RouteChunk(context, bind_data, global_state, chunk);
+			}
+			return;
+		}
+		auto &file_writer = *global_state.file_writer;
+
+		if (file_writer.sink) {
+			// Blocks while the queue of the writer is full
+			for (auto &point_batch : batch_data.point_batches) {
+				file_writer.sink->Push(std::move(point_batch));
+			}
+			return;
+		}
+
+		lock_guard<mutex> guard(file_writer.lock);
+		file_writer.buffers.push_back(std::move(batch_data.buffer));
+	}
+
+	// Like the Parquet writer, keep the order of the rows with batches when required, otherwise sink in parallel.
+	static CopyFunctionExecutionMode ExecutionMode(bool preserve_insertion_order, bool supports_batch_index) {
+		if (!preserve_insertion_order) {
+			return CopyFunctionExecutionMode::PARALLEL_COPY_TO_FILE;
+		}
+		if (supports_batch_index) {
+			return CopyFunctionExecutionMode::BATCH_COPY_TO_FILE;
+		}
+		return CopyFunctionExecutionMode::REGULAR_COPY_TO_FILE;
 	}
 
 	//------------------------------------------------------------------------------------------------------------------
@@ -1385,12 +4114,18 @@ struct PDAL_Write {
 	//------------------------------------------------------------------------------------------------------------------
 
 	static void Finalize(ClientContext &context, FunctionData &fdata, GlobalFunctionData &gstate) {
-		auto &bind_data = fdata.Cast<BindData>();
+		auto &global_state = gstate.Cast<GlobalState>();
 
-		// Flush writer
-		pdal::PointTable *table = bind_data.table.get();
-		pdal::Stage *writer = bind_data.writer;
-		writer->execute(*table);
+		if (global_state.file_writer) {
+			FinishFileWriter(*global_state.file_writer);
+			return;
+		}
+
+		// Write the tiles
+		for (auto &entry : global_state.tiles) {
+			GlobalState::CloseTile(*entry.second);
+		}
+		global_state.tiles.clear();
 	}
 
 	//------------------------------------------------------------------------------------------------------------------
@@ -1405,6 +4140,9 @@ struct PDAL_Write {
 		info.copy_to_sink = Sink;
 		info.copy_to_combine = Combine;
 		info.copy_to_finalize = Finalize;
+		info.execution_mode = ExecutionMode;
+		info.prepare_batch = PrepareBatch;
+		info.flush_batch = FlushBatch;
 		info.extension = "pdal";
 
 		loader.RegisterFunction(info);
@@ -1421,6 +4159,8 @@ void PdalTableFunctions::Register(ExtensionLoader &loader) {
 
 	PDAL_Drivers::Register(loader);
 	PDAL_Info::Register(loader);
+	PDAL_MetadataCache::Register(loader);
+	PDAL_ClearMetadataCache::Register(loader);
 	PDAL_Read::Register(loader);
 	PDAL_Pipeline::Register(loader);
 	PDAL_Write::Register(loader);